@@ -0,0 +1,27 @@
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#if __riscv_xlen == 64
+#define LREG ld
+#define SREG sd
+#define REGBYTES 8
+#else
+#define LREG lw
+#define SREG sw
+#define REGBYTES 4
+#endif
+
+#define MSTATUS_MPP 0x00001800
+#define MSTATUS_MPP_S 0x00000800
+#define MSTATUS_MIE 0x00000008
+
+#define CAUSE_LOAD_PAGE_FAULT 13
+#define CAUSE_ECALL_S 9
+#define CAUSE_ECALL_M 11
+
+// number of loop iterations, can be overridden with CFLAGS=-DITERATIONS=...
+#ifndef ITERATIONS
+#define ITERATIONS 1000000
+#endif
+
+#endif /* _BENCH_H_ */
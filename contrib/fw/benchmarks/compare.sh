@@ -0,0 +1,62 @@
+#!/bin/sh
+# Runs the cases listed in compare.cases with a riscv-sim built from the baseline and one built from the current
+# tree and prints the results as rows of the results table in README.md, e.g.
+#   make && ./compare.sh ~/baseline/build/riscv-sim ../../../build/riscv-sim "interp asmjit llvm tcc"
+# Each side of a case runs RUNS times (default 3), the fastest run is reported. The MIPS are the instructions
+# reported by the simulator divided by the wall clock time of the whole process, so they include the start up.
+
+if [ $# -lt 2 ] || [ ! -x "$1" ] || [ ! -x "$2" ]; then
+    echo "usage: $0 <baseline riscv-sim> <riscv-sim> [backends]" >&2
+    exit 1
+fi
+base=$1
+series=$2
+backends=${3:-interp}
+runs=${RUNS:-3}
+cd "$(dirname "$0")" || exit 1
+
+# measure <side> <backend> <isa>: prints 'MIPS ms' of the fastest run, 'n/a n/a' if the side is not given and
+# 'fail fail' if the simulator failed or did not report the executed instructions
+measure() {
+    if [ "$1" = "-" ]; then
+        echo "n/a n/a"
+        return
+    fi
+    bin=${1%%:*}
+    rest=${1#*:}
+    elf=${rest%%:*}
+    args=
+    [ "$elf" != "$rest" ] && args=${rest#*:}
+    sim=$series
+    [ "$bin" = "base" ] && sim=$base
+    best_ms=
+    best_instr=
+    i=0
+    while [ $i -lt "$runs" ]; do
+        i=$((i + 1))
+        start=$(date +%s%N)
+        # shellcheck disable=SC2086
+        out=$("$sim" --backend "$2" --isa "$3" $args -f "$elf" 2>&1) || { echo "fail fail"; return; }
+        end=$(date +%s%N)
+        instr=$(echo "$out" | sed -n 's/.*[Ee]xecuted \([0-9]*\) instructions.*/\1/p' | tail -n 1)
+        [ -n "$instr" ] || { echo "fail fail"; return; }
+        ms=$(((end - start) / 1000000))
+        if [ -z "$best_ms" ] || [ "$ms" -lt "$best_ms" ]; then
+            best_ms=$ms
+            best_instr=$instr
+        fi
+    done
+    awk -v i="$best_instr" -v ms="$best_ms" 'BEGIN { printf "%.1f %d\n", (ms > 0 ? i / ms / 1000 : 0), ms }'
+}
+
+echo "| request | case | backend | baseline MIPS | baseline ms | MIPS | ms |"
+echo "|---------|------|---------|---------------|-------------|------|----|"
+grep -v '^#' compare.cases | grep -v '^$' | while IFS=';' read -r request label isa before after; do
+    for backend in $backends; do
+        set -- $(measure "$before" "$backend" "$isa")
+        b_mips=$1
+        b_ms=$2
+        set -- $(measure "$after" "$backend" "$isa")
+        echo "| $request | $label | $backend | $b_mips | $b_ms | $1 | $2 |"
+    done
+done
@@ -0,0 +1,52 @@
+#!/bin/sh
+# Runs a SystemC platform using core_complex built against the baseline and against the current tree with the same
+# options and prints one row of the results table for each, e.g.
+#   ./compare_vp.sh ~/baseline/build/tgc-vp ../../../build/tgc-vp -f hello.elf
+# The platform has to enable the post_run_stats parameter of the core_complex, its 'Ran <n> instructions' line gives
+# the instruction count. Each platform runs RUNS times (default 3), the fastest run is reported. The transactions per
+# instruction of the data bus and of the fetches without DMI are shown as reported by the last run.
+
+if [ $# -lt 2 ] || [ ! -x "$1" ] || [ ! -x "$2" ]; then
+    echo "usage: $0 <baseline platform> <platform> [platform options]" >&2
+    exit 1
+fi
+base=$1
+series=$2
+shift 2
+runs=${RUNS:-3}
+
+# measure <platform> <options...>: prints '<MIPS> <ms> <dbus transactions/instr> <fetch transactions/instr>'
+measure() {
+    vp=$1
+    shift
+    best_ms=
+    best_instr=
+    i=0
+    while [ $i -lt "$runs" ]; do
+        i=$((i + 1))
+        start=$(date +%s%N)
+        out=$("$vp" "$@" 2>&1) || { echo "fail fail - -"; return; }
+        end=$(date +%s%N)
+        instr=$(echo "$out" | sed -n 's/.*Ran \([0-9]*\) instructions.*/\1/p' | tail -n 1)
+        [ -n "$instr" ] || { echo "fail fail - -"; return; }
+        ms=$(((end - start) / 1000000))
+        if [ -z "$best_ms" ] || [ "$ms" -lt "$best_ms" ]; then
+            best_ms=$ms
+            best_instr=$instr
+        fi
+    done
+    dbus=$(echo "$out" | sed -n 's/.*Issued [0-9]* dbus transactions, \([0-9.e+-]*\) per instruction.*/\1/p' | tail -n 1)
+    fetch=$(echo "$out" | sed -n 's/.*Fetched \([0-9]*\) instructions w\/o DMI using \([0-9]*\) transactions.*/\2\/\1/p' | tail -n 1)
+    awk -v i="$best_instr" -v ms="$best_ms" -v d="${dbus:--}" -v f="${fetch:--}" \
+        'BEGIN { if(split(f, t, "/") == 2) f = sprintf("%.3f", t[1] / t[2]); printf "%.1f %d %s %s\n", (ms > 0 ? i / ms / 1000 : 0), ms, d, f }'
+}
+
+echo "| platform | MIPS | ms | dbus transactions/instr | fetch transactions/instr |"
+echo "|----------|------|----|-------------------------|--------------------------|"
+set -- "$base" "$@"
+# shellcheck disable=SC2046
+set -- $(measure "$@") "$@"
+echo "| baseline | $1 | $2 | $3 | $4 |"
+shift 5
+set -- $(measure "$series" "$@")
+echo "| current | $1 | $2 | $3 | $4 |"
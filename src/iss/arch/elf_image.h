@@ -0,0 +1,249 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_ARCH_ELF_IMAGE_H_
+#define _ISS_ARCH_ELF_IMAGE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <elfio/elf_types.hpp>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace iss {
+namespace arch {
+/**
+ * read-only view onto a memory mapped ELF file. Only the headers are parsed when opening the file,
+ * the segment data is used in place and the symbol indices are built when they are requested first.
+ */
+class elf_image {
+public:
+    struct segment {
+        uint64_t paddr;
+        uint8_t const* data;
+        uint64_t file_size;
+        uint64_t mem_size;
+    };
+
+    elf_image() = default;
+
+    elf_image(elf_image const&) = delete;
+
+    elf_image& operator=(elf_image const&) = delete;
+
+    ~elf_image() {
+#ifndef _WIN32
+        if(base)
+            munmap(const_cast<uint8_t*>(base), size);
+#endif
+    }
+
+    bool open(std::string const& name) {
+#ifndef _WIN32
+        auto fd = ::open(name.c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+        struct stat st;
+        if(fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(ELFIO::Elf32_Ehdr)) {
+            ::close(fd);
+            return false;
+        }
+        size = st.st_size;
+        auto* ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if(ptr == MAP_FAILED)
+            return false;
+        base = static_cast<uint8_t const*>(ptr);
+#else
+        std::ifstream ifs(name, std::ios::binary | std::ios::ate);
+        if(!ifs)
+            return false;
+        buffer.resize(ifs.tellg());
+        ifs.seekg(0);
+        if(buffer.size() < sizeof(ELFIO::Elf32_Ehdr) || !ifs.read(reinterpret_cast<char*>(buffer.data()), buffer.size()))
+            return false;
+        base = buffer.data();
+        size = buffer.size();
+#endif
+        if(base[ELFIO::EI_MAG0] != ELFIO::ELFMAG0 || base[ELFIO::EI_MAG1] != ELFIO::ELFMAG1 || base[ELFIO::EI_MAG2] != ELFIO::ELFMAG2 ||
+           base[ELFIO::EI_MAG3] != ELFIO::ELFMAG3 || base[ELFIO::EI_DATA] != ELFIO::ELFDATA2LSB)
+            return false;
+        elf_class = base[ELFIO::EI_CLASS];
+        if(elf_class == ELFIO::ELFCLASS32)
+            return parse<ELFIO::Elf32_Ehdr, ELFIO::Elf32_Phdr, ELFIO::Elf32_Shdr>();
+        if(elf_class == ELFIO::ELFCLASS64)
+            return parse<ELFIO::Elf64_Ehdr, ELFIO::Elf64_Phdr, ELFIO::Elf64_Shdr>();
+        return false;
+    }
+
+    uint8_t get_class() const { return elf_class; }
+
+    uint16_t get_type() const { return type; }
+
+    uint16_t get_machine() const { return machine; }
+
+    uint64_t get_entry() const { return entry; }
+
+    std::vector<segment> const& get_load_segments() const { return segments; }
+
+    //! looks up a single symbol without building the index, the last definition wins like in the index
+    std::optional<uint64_t> find_symbol(std::string_view name) const {
+        std::optional<uint64_t> res;
+        for_each_symbol([&res, name](std::string_view sym, uint64_t value) {
+            if(sym == name)
+                res = value;
+        });
+        return res;
+    }
+
+    //! name to address index, built on first use
+    std::unordered_map<std::string, uint64_t> const& get_symbol_table() {
+        if(!name_index_valid) {
+            name_index.reserve(sym_count);
+            for_each_symbol([this](std::string_view sym, uint64_t value) { name_index[std::string(sym)] = value; });
+            name_index_valid = true;
+        }
+        return name_index;
+    }
+
+    //! address to name index, built on first use
+    std::map<uint64_t, std::string> const& get_address_table() {
+        if(!addr_index_valid) {
+            for_each_symbol([this](std::string_view sym, uint64_t value) { addr_index.emplace(value, sym); });
+            addr_index_valid = true;
+        }
+        return addr_index;
+    }
+
+private:
+    template <typename EHDR, typename PHDR, typename SHDR> bool parse() {
+        if(size < sizeof(EHDR))
+            return false;
+        EHDR ehdr;
+        std::memcpy(&ehdr, base, sizeof(EHDR));
+        type = ehdr.e_type;
+        machine = ehdr.e_machine;
+        entry = ehdr.e_entry;
+        if(ehdr.e_phoff + static_cast<uint64_t>(ehdr.e_phnum) * sizeof(PHDR) > size)
+            return false;
+        for(auto i = 0U; i < ehdr.e_phnum; ++i) {
+            PHDR phdr;
+            std::memcpy(&phdr, base + ehdr.e_phoff + i * sizeof(PHDR), sizeof(PHDR));
+            if(phdr.p_type != ELFIO::PT_LOAD)
+                continue;
+            if(phdr.p_offset + phdr.p_filesz > size)
+                return false;
+            segments.push_back({phdr.p_paddr, base + phdr.p_offset, phdr.p_filesz, phdr.p_memsz});
+        }
+        if(!ehdr.e_shoff || ehdr.e_shoff + static_cast<uint64_t>(ehdr.e_shnum) * sizeof(SHDR) > size)
+            return true;
+        auto read_shdr = [this, &ehdr](unsigned idx) {
+            SHDR shdr;
+            std::memcpy(&shdr, base + ehdr.e_shoff + idx * sizeof(SHDR), sizeof(SHDR));
+            return shdr;
+        };
+        for(auto i = 0U; i < ehdr.e_shnum; ++i) {
+            auto shdr = read_shdr(i);
+            if(shdr.sh_type != ELFIO::SHT_SYMTAB && (shdr.sh_type != ELFIO::SHT_DYNSYM || symtab))
+                continue;
+            if(shdr.sh_link >= ehdr.e_shnum || shdr.sh_offset + shdr.sh_size > size)
+                continue;
+            auto strtab_hdr = read_shdr(shdr.sh_link);
+            if(strtab_hdr.sh_offset + strtab_hdr.sh_size > size)
+                continue;
+            symtab = base + shdr.sh_offset;
+            sym_count = shdr.sh_entsize ? shdr.sh_size / shdr.sh_entsize : 0;
+            sym_size = shdr.sh_entsize;
+            strtab = reinterpret_cast<char const*>(base + strtab_hdr.sh_offset);
+            strtab_size = strtab_hdr.sh_size;
+            if(shdr.sh_type == ELFIO::SHT_SYMTAB)
+                break;
+        }
+        return true;
+    }
+
+    template <typename F> void for_each_symbol(F&& f) const {
+        if(elf_class == ELFIO::ELFCLASS32)
+            for_each_symbol<ELFIO::Elf32_Sym>(std::forward<F>(f));
+        else
+            for_each_symbol<ELFIO::Elf64_Sym>(std::forward<F>(f));
+    }
+
+    template <typename SYM, typename F> void for_each_symbol(F&& f) const {
+        if(sym_size < sizeof(SYM))
+            return;
+        for(auto i = 0U; i < sym_count; ++i) {
+            SYM sym;
+            std::memcpy(&sym, symtab + i * sym_size, sizeof(SYM));
+            if(sym.st_name == 0 || sym.st_name >= strtab_size)
+                continue;
+            auto const* name = strtab + sym.st_name;
+            f(std::string_view(name, strnlen(name, strtab_size - sym.st_name)), sym.st_value);
+        }
+    }
+
+    uint8_t const* base{nullptr};
+    uint64_t size{0};
+#ifdef _WIN32
+    std::vector<uint8_t> buffer;
+#endif
+    uint8_t elf_class{0};
+    uint16_t type{0};
+    uint16_t machine{0};
+    uint64_t entry{0};
+    std::vector<segment> segments;
+    uint8_t const* symtab{nullptr};
+    uint64_t sym_count{0};
+    uint64_t sym_size{0};
+    char const* strtab{nullptr};
+    uint64_t strtab_size{0};
+    std::unordered_map<std::string, uint64_t> name_index;
+    bool name_index_valid{false};
+    std::map<uint64_t, std::string> addr_index;
+    bool addr_index_valid{false};
+};
+} // namespace arch
+} // namespace iss
+#endif /* _ISS_ARCH_ELF_IMAGE_H_ */
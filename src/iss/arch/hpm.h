@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_ARCH_HPM_H_
+#define _ISS_ARCH_HPM_H_
+
+#include <array>
+#include <cstdint>
+
+namespace iss {
+namespace arch {
+/**
+ * events which can be selected by writing their number to one of the mhpmevent3..31 CSRs
+ */
+enum hpm_event : unsigned {
+    HPM_NONE = 0,
+    HPM_EXCEPTION = 1,    // synchronous traps taken
+    HPM_INTERRUPT = 2,    // interrupts taken
+    HPM_TLB_MISS = 3,     // address translations not found in the TLB
+    HPM_PMP_CHECK = 4,    // accesses checked by the PMP
+    HPM_PMP_FAULT = 5,    // accesses denied by the PMP
+    HPM_ICACHE_MISS = 6,  // instruction cache misses (needs a cache model)
+    HPM_DCACHE_MISS = 7,  // data cache misses (needs a cache model)
+    HPM_BRANCH = 8,       // retired conditional branches
+    HPM_BRANCH_TAKEN = 9, // retired conditional branches which were taken
+    HPM_JUMP = 10,        // retired jal/jalr
+    HPM_LOAD = 11,        // retired loads incl. floating point and vector loads
+    HPM_STORE = 12,       // retired stores incl. floating point and vector stores
+    HPM_ATOMIC = 13,      // retired LR/SC/AMO
+    HPM_MULDIV = 14,      // retired multiplications and divisions
+    HPM_FP = 15,          // retired floating point computations
+    HPM_SYSTEM = 16,      // retired CSR accesses and system instructions
+    HPM_VECTOR = 17,      // retired vector computations
+    HPM_NUM_EVENTS
+};
+
+/**
+ * the hardware performance monitor counters of a hart. Event sources call count() which is a single test of a bit
+ * mask if the event is not selected by any counter. The instruction class events need to be counted by the VMs,
+ * they check instr_active before doing any work. VMs doing so announce it using support_instr_events(), otherwise
+ * these events cannot be selected.
+ */
+struct hpm_counters {
+    static constexpr uint64_t instr_events = (1ULL << HPM_BRANCH) | (1ULL << HPM_BRANCH_TAKEN) | (1ULL << HPM_JUMP) |
+                                             (1ULL << HPM_LOAD) | (1ULL << HPM_STORE) | (1ULL << HPM_ATOMIC) |
+                                             (1ULL << HPM_MULDIV) | (1ULL << HPM_FP) | (1ULL << HPM_SYSTEM) | (1ULL << HPM_VECTOR);
+    //! the events selected by at least one counter
+    uint64_t active{0};
+    //! the instruction class events selected by at least one counter
+    uint64_t instr_active{0};
+    std::array<uint64_t, HPM_NUM_EVENTS> events{};
+    //! the events which can be selected
+    uint64_t supported{~instr_events};
+
+    void support_instr_events() { supported |= instr_events; }
+
+    void count(hpm_event evt, uint64_t n = 1) {
+        if(active & (1ULL << evt))
+            events[evt] += n;
+    }
+
+    //! classifies a retired instruction, taken denotes a taken branch
+    template <unsigned XLEN> void count_instr(uint32_t instr, bool taken) {
+        auto evt = classify<XLEN>(instr);
+        count(evt);
+        if(evt == HPM_BRANCH && taken)
+            count(HPM_BRANCH_TAKEN);
+    }
+
+    template <unsigned XLEN> static hpm_event classify(uint32_t instr) {
+        if((instr & 3) != 3) {
+            auto const funct3 = (instr >> 13) & 7;
+            switch(instr & 3) {
+            case 0:
+                return funct3 == 0 ? HPM_NONE : funct3 < 4 ? HPM_LOAD : funct3 > 4 ? HPM_STORE : HPM_NONE;
+            case 1:
+                return funct3 == 5 || (funct3 == 1 && XLEN == 32) ? HPM_JUMP : funct3 >= 6 ? HPM_BRANCH : HPM_NONE;
+            default:
+                if(funct3 == 4)
+                    return ((instr >> 2) & 31) == 0 && ((instr >> 7) & 31) != 0 ? HPM_JUMP : HPM_NONE;
+                return funct3 == 0 ? HPM_NONE : funct3 < 4 ? HPM_LOAD : funct3 > 4 ? HPM_STORE : HPM_NONE;
+            }
+        }
+        switch(instr & 0x7f) {
+        case 0x03: // LOAD
+        case 0x07: // LOAD-FP
+            return HPM_LOAD;
+        case 0x23: // STORE
+        case 0x27: // STORE-FP
+            return HPM_STORE;
+        case 0x63:
+            return HPM_BRANCH;
+        case 0x67: // JALR
+        case 0x6f: // JAL
+            return HPM_JUMP;
+        case 0x2f:
+            return HPM_ATOMIC;
+        case 0x33: // OP
+        case 0x3b: // OP-32
+            return (instr >> 25) == 1 ? HPM_MULDIV : HPM_NONE;
+        case 0x43: // MADD
+        case 0x47: // MSUB
+        case 0x4b: // NMSUB
+        case 0x4f: // NMADD
+        case 0x53: // OP-FP
+            return HPM_FP;
+        case 0x57: // OP-V
+            return HPM_VECTOR;
+        case 0x73:
+            return HPM_SYSTEM;
+        default:
+            return HPM_NONE;
+        }
+    }
+
+    uint64_t get_counter(unsigned idx) const {
+        if(inhibit & (1U << idx))
+            return offset[idx];
+        return events[selector[idx]] + offset[idx];
+    }
+
+    void set_counter(unsigned idx, uint64_t val) { offset[idx] = inhibit & (1U << idx) ? val : val - events[selector[idx]]; }
+
+    uint64_t get_event(unsigned idx) const { return selector[idx]; }
+
+    //! selects the event counted by counter idx, unknown or unsupported events are ignored (WARL)
+    void set_event(unsigned idx, uint64_t evt) {
+        auto const val = get_counter(idx);
+        selector[idx] = evt < HPM_NUM_EVENTS && (supported & (1ULL << evt)) ? evt : HPM_NONE;
+        set_counter(idx, val);
+        update_active();
+    }
+
+    uint32_t get_inhibit() const { return inhibit; }
+
+    //! mcountinhibit, only bits 3..31 (the programmable counters) are handled here
+    void set_inhibit(uint32_t val) {
+        for(auto idx = 3U; idx < 32; ++idx) {
+            if(((inhibit ^ val) >> idx) & 1) {
+                auto const cnt = get_counter(idx);
+                inhibit ^= 1U << idx;
+                set_counter(idx, cnt);
+            }
+        }
+        update_active();
+    }
+
+private:
+    void update_active() {
+        active = 0;
+        for(auto idx = 3U; idx < 32; ++idx)
+            if(!(inhibit & (1U << idx)))
+                active |= 1ULL << selector[idx];
+        active &= ~1ULL;
+        // the taken branches are counted when classifying the branches
+        if(active & (1ULL << HPM_BRANCH_TAKEN))
+            active |= 1ULL << HPM_BRANCH;
+        instr_active = active & instr_events;
+    }
+
+    std::array<unsigned, 32> selector{};
+    //! counter value minus the event count or the frozen counter value if inhibited
+    std::array<uint64_t, 32> offset{};
+    uint32_t inhibit{0};
+};
+} // namespace arch
+} // namespace iss
+#endif /* _ISS_ARCH_HPM_H_ */
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_ARCH_IDLE_LOOP_H_
+#define _ISS_ARCH_IDLE_LOOP_H_
+
+#include <cstdint>
+
+namespace iss {
+namespace arch {
+
+enum class idle_loop_mode { OFF, SKIP, LOG };
+
+//! max. number of instructions of a loop considered for idle loop detection
+constexpr unsigned idle_loop_max_instr = 16;
+//! max. distance in bytes of the backward jump closing a loop
+constexpr unsigned idle_loop_max_span = 4 * idle_loop_max_instr;
+
+namespace detail {
+struct idle_insn {
+    enum kind_e { PURE, BRANCH, JUMP, ILLEGAL } kind{ILLEGAL};
+    unsigned length{4};
+    uint32_t reads{0};  // bit mask of the source registers
+    uint32_t writes{0}; // bit mask of the destination registers
+    int64_t offset{0};  // jump/branch offset
+};
+
+inline int64_t sext(uint64_t val, unsigned bits) { return static_cast<int64_t>(val << (64 - bits)) >> (64 - bits); }
+
+inline uint32_t reg_bit(unsigned r) { return (1U << r) & ~1U; }
+
+template <unsigned XLEN> idle_insn decode_idle_insn32(uint32_t i) {
+    idle_insn res;
+    auto rd = (i >> 7) & 31, rs1 = (i >> 15) & 31, rs2 = (i >> 20) & 31, funct3 = (i >> 12) & 7;
+    switch(i & 0x7f) {
+    case 0x37: // LUI
+    case 0x17: // AUIPC
+        return {idle_insn::PURE, 4, 0, reg_bit(rd)};
+    case 0x1b: // OP-IMM-32
+        if(XLEN == 32)
+            return res;
+        /* FALLTHRU */
+    case 0x13: // OP-IMM
+    case 0x03: // LOAD
+        return {idle_insn::PURE, 4, reg_bit(rs1), reg_bit(rd)};
+    case 0x3b: // OP-32
+        if(XLEN == 32)
+            return res;
+        /* FALLTHRU */
+    case 0x33: // OP
+        return {idle_insn::PURE, 4, reg_bit(rs1) | reg_bit(rs2), reg_bit(rd)};
+    case 0x0f: // FENCE, but not FENCE.I
+        if(funct3 == 0)
+            return {idle_insn::PURE, 4};
+        return res;
+    case 0x73: // CSR reads
+        // instret and the hpm counters only advance when executing instructions, skipping time does not help
+        if(((i >> 20) & 0xf60) == 0xc00 || ((i >> 20) & 0xf60) == 0xb00) {
+            if(((i >> 20) & 0x1f) >= 2)
+                return res;
+        }
+        if((funct3 & 3) >= 2 && rs1 == 0) // CSRRS/CSRRC(I) with x0/zero source
+            return {idle_insn::PURE, 4, 0, reg_bit(rd)};
+        return res;
+    case 0x63: // BRANCH
+        if(funct3 == 2 || funct3 == 3)
+            return res;
+        return {idle_insn::BRANCH, 4, reg_bit(rs1) | reg_bit(rs2), 0,
+                sext(((i >> 31) & 1) << 12 | ((i >> 7) & 1) << 11 | ((i >> 25) & 0x3f) << 5 | ((i >> 8) & 0xf) << 1, 13)};
+    case 0x6f: // JAL without link
+        if(rd)
+            return res;
+        return {idle_insn::JUMP, 4, 0, 0,
+                sext(((i >> 31) & 1) << 20 | ((i >> 12) & 0xff) << 12 | ((i >> 20) & 1) << 11 | ((i >> 21) & 0x3ff) << 1, 21)};
+    default:
+        return res;
+    }
+}
+
+template <unsigned XLEN> idle_insn decode_idle_insn16(uint16_t i) {
+    idle_insn res;
+    res.length = 2;
+    auto rd = (i >> 7) & 31U, rs2 = (i >> 2) & 31U, rdp = 8 + ((i >> 7) & 7U), rs2p = 8 + ((i >> 2) & 7U), funct3 = (i >> 13) & 7U;
+    switch((i & 3) << 3 | funct3) {
+    case 0b00000: // C.ADDI4SPN
+        if(i == 0)
+            return res;
+        return {idle_insn::PURE, 2, reg_bit(2), reg_bit(rs2p)};
+    case 0b00010: // C.LW
+        return {idle_insn::PURE, 2, reg_bit(rdp), reg_bit(rs2p)};
+    case 0b00011: // C.LD
+        if(XLEN == 32)
+            return res;
+        return {idle_insn::PURE, 2, reg_bit(rdp), reg_bit(rs2p)};
+    case 0b01001: // C.ADDIW
+        if(XLEN == 32)
+            return res;
+        /* FALLTHRU */
+    case 0b01000: // C.ADDI
+    case 0b10000: // C.SLLI
+        return {idle_insn::PURE, 2, reg_bit(rd), reg_bit(rd)};
+    case 0b01010: // C.LI
+        return {idle_insn::PURE, 2, 0, reg_bit(rd)};
+    case 0b01011: // C.ADDI16SP, C.LUI
+        return {idle_insn::PURE, 2, rd == 2 ? reg_bit(2) : 0, reg_bit(rd)};
+    case 0b01100: // C.SRLI, C.SRAI, C.ANDI, C.SUB, ...
+        return {idle_insn::PURE, 2, reg_bit(rdp) | (((i >> 10) & 3) == 3 ? reg_bit(rs2p) : 0), reg_bit(rdp)};
+    case 0b01101: // C.J
+        return {idle_insn::JUMP, 2, 0, 0,
+                sext(((i >> 12) & 1) << 11 | ((i >> 11) & 1) << 4 | ((i >> 9) & 3) << 8 | ((i >> 8) & 1) << 10 | ((i >> 7) & 1) << 6 |
+                         ((i >> 6) & 1) << 7 | ((i >> 3) & 7) << 1 | ((i >> 2) & 1) << 5,
+                     12)};
+    case 0b01110: // C.BEQZ
+    case 0b01111: // C.BNEZ
+        return {idle_insn::BRANCH, 2, reg_bit(rdp), 0,
+                sext(((i >> 12) & 1) << 8 | ((i >> 10) & 3) << 3 | ((i >> 5) & 3) << 6 | ((i >> 3) & 3) << 1 | ((i >> 2) & 1) << 5, 9)};
+    case 0b10010: // C.LWSP
+        return {idle_insn::PURE, 2, reg_bit(2), reg_bit(rd)};
+    case 0b10011: // C.LDSP
+        if(XLEN == 32)
+            return res;
+        return {idle_insn::PURE, 2, reg_bit(2), reg_bit(rd)};
+    case 0b10100: // C.MV, C.ADD but not C.JR, C.JALR, C.EBREAK
+        if(rs2 == 0)
+            return res;
+        return {idle_insn::PURE, 2, reg_bit(rs2) | ((i >> 12) & 1 ? reg_bit(rd) : 0), reg_bit(rd)};
+    default:
+        return res;
+    }
+}
+} // namespace detail
+
+/**
+ * checks if the code starting at head is a side effect free polling loop. Such a loop consists of loads, CSR reads and
+ * register-register operations only and is closed by a branch or jump back to head, forward branches may leave it. In
+ * addition no register read by the loop may be written by it before, so each iteration computes the same values from the
+ * loop invariant registers, the memory (MMIO) and the counters. As long as these inputs do not change the loop does
+ * not make progress and the time until the next event can be skipped.
+ *
+ * @param head the address of the first instruction of the loop
+ * @param fetch a callable bool(uint64_t addr, uint32_t& insn) reading 4 bytes of code
+ * @return the number of instructions executed per iteration or 0 if the code is not an idle loop
+ */
+template <unsigned XLEN, typename FETCH> unsigned analyze_idle_loop(uint64_t head, FETCH&& fetch) {
+    uint32_t live_in = 0, written = 0;
+    uint64_t exit_min = UINT64_MAX;
+    auto pc = head;
+    for(auto n = 1U; n <= idle_loop_max_instr; ++n) {
+        uint32_t insn = 0;
+        if(!fetch(pc, insn))
+            return 0;
+        auto d = (insn & 3) == 3 ? detail::decode_idle_insn32<XLEN>(insn) : detail::decode_idle_insn16<XLEN>(insn & 0xffff);
+        if(d.kind == detail::idle_insn::ILLEGAL)
+            return 0;
+        live_in |= d.reads & ~written;
+        written |= d.writes;
+        auto target = pc + d.offset;
+        if(d.kind != detail::idle_insn::PURE && target == head)
+            return (live_in & written) == 0 && exit_min > pc ? n : 0;
+        if(d.kind == detail::idle_insn::JUMP || (d.kind == detail::idle_insn::BRANCH && target <= pc))
+            return 0;
+        if(d.kind == detail::idle_insn::BRANCH && target < exit_min)
+            exit_min = target;
+        pc += d.length;
+    }
+    return 0;
+}
+} // namespace arch
+} // namespace iss
+#endif /* _ISS_ARCH_IDLE_LOOP_H_ */
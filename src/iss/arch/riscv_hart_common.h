@@ -35,21 +35,34 @@
 #ifndef _RISCV_HART_COMMON
 #define _RISCV_HART_COMMON
 
+#include "elf_image.h"
+#include "hpm.h"
+#include "idle_loop.h"
 #include "mstatus.h"
 #include <array>
+#include <bitset>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <elfio/elf_types.hpp>
 #include <elfio/elfio.hpp>
 #include <fmt/format.h>
 #include <iss/arch/traits.h>
 #include <iss/arch_if.h>
 #include <iss/log_categories.h>
+#include <iss/mem/atomic.h>
 #include <iss/mem/memory_if.h>
+#include <iss/semihosting/htif_syscalls.h>
 #include <iss/semihosting/semihosting.h>
 #include <iss/vm_types.h>
 #include <limits>
+#include <memory>
+#include <new>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <util/delegate.h>
 #include <util/instance_logger.h>
@@ -214,6 +227,7 @@ enum riscv_csr {
     /*...*/
     mhpmcounter31h = 0xB9F,
     // Machine Counter Setup
+    mcountinhibit = 0x320,
     mhpmevent3 = 0x323,
     mhpmevent4 = 0x324,
     /*...*/
@@ -289,27 +303,161 @@ public:
     : trap_access(15 << 16, badaddr) {}
 };
 
+/**
+ * callable holding a small, trivially copyable functor (e.g. a lambda capturing only this) inline. It is called
+ * through a single function pointer and never allocates, unlike std::function. Like std::function, calling an
+ * empty delegate throws std::bad_function_call.
+ */
+template <typename SIG> class small_delegate;
+template <typename R, typename... ARGS> class small_delegate<R(ARGS...)> {
+    template <typename F>
+    static constexpr bool fits = !std::is_same_v<std::decay_t<F>, small_delegate> && std::is_trivially_copyable_v<F> &&
+                                 sizeof(F) <= 2 * sizeof(void*) && alignof(F) <= alignof(void*) && std::is_invocable_r_v<R, F const&, ARGS...>;
+
+public:
+    small_delegate() = default;
+
+    small_delegate(std::nullptr_t) {}
+
+    template <typename F, typename = std::enable_if_t<fits<F>>> small_delegate(F f) {
+        new(storage) F(f);
+        call = [](void const* obj, ARGS... args) -> R { return (*static_cast<F const*>(obj))(std::forward<ARGS>(args)...); };
+    }
+
+    R operator()(ARGS... args) const { return call(storage, std::forward<ARGS>(args)...); }
+
+    explicit operator bool() const { return call != &empty_call; }
+
+private:
+    static R empty_call(void const*, ARGS...) { throw std::bad_function_call(); }
+
+    alignas(void*) unsigned char storage[2 * sizeof(void*)]{};
+    R (*call)(void const*, ARGS...){&empty_call};
+};
+
 template <typename WORD_TYPE> struct priv_if {
-    using rd_csr_f = std::function<iss::status(unsigned addr, WORD_TYPE&)>;
-    using wr_csr_f = std::function<iss::status(unsigned addr, WORD_TYPE)>;
-
-    std::function<iss::status(unsigned, WORD_TYPE&)> read_csr;
-    std::function<iss::status(unsigned, WORD_TYPE)> write_csr;
-    std::function<WORD_TYPE(unsigned)> get_csr;
-    std::function<void(unsigned, WORD_TYPE)> set_csr;
-    std::function<iss::status(uint8_t const*, unsigned)> exec_htif;
-    std::function<void(uint16_t, uint16_t, WORD_TYPE)> raise_trap; // trap_id, cause, fault_data
-    std::unordered_map<unsigned, rd_csr_f>& csr_rd_cb;
-    std::unordered_map<unsigned, wr_csr_f>& csr_wr_cb;
+    using rd_csr_f = small_delegate<iss::status(unsigned addr, WORD_TYPE&)>;
+    using wr_csr_f = small_delegate<iss::status(unsigned addr, WORD_TYPE)>;
+
+    small_delegate<iss::status(unsigned, WORD_TYPE&)> read_csr;
+    small_delegate<iss::status(unsigned, WORD_TYPE)> write_csr;
+    small_delegate<WORD_TYPE(unsigned)> get_csr;
+    small_delegate<void(unsigned, WORD_TYPE)> set_csr;
+    small_delegate<iss::status(uint8_t const*, unsigned)> exec_htif;
+    small_delegate<void(uint16_t, uint16_t, WORD_TYPE)> raise_trap; // trap_id, cause, fault_data
+    std::array<rd_csr_f, 4096>& csr_rd_cb;
+    std::array<wr_csr_f, 4096>& csr_wr_cb;
     hart_state<WORD_TYPE>& state;
     uint8_t& PRIV;
     WORD_TYPE& PC;
     uint64_t& tohost;
     uint64_t& fromhost;
     unsigned& max_irq;
+    hpm_counters& hpm;
+};
+
+/**
+ * selects the interrupt to be taken from the non-empty set of pending and enabled interrupts (bit positions of mip).
+ * The standard interrupts are prioritized as given by the privileged spec (MEI, MSI, MTI, SEI, SSI, STI, UEI, USI, UTI),
+ * all others (e.g. LCOFI and the platform interrupts) follow with the lowest number first
+ */
+inline unsigned select_interrupt(uint64_t irqs) {
+    if(auto const std_irqs = static_cast<unsigned>(irqs & 0xfff)) {
+        // fold external, timer and software interrupts onto their privilege level and take the highest one
+        auto const priv = 31 - __builtin_clz((std_irqs | std_irqs >> 4 | std_irqs >> 8) & 0xf);
+        if(std_irqs & (0x100U << priv))
+            return 8 + priv;
+        if(std_irqs & (0x1U << priv))
+            return priv;
+        return 4 + priv;
+    }
+    return __builtin_ctzll(irqs);
+}
+
+/**
+ * describes how translated code can read a side effect free CSR without calling the CSR dispatch of the hart. The
+ * value is ((src + *offset) / divider) >> shift, truncated to XLEN bits
+ */
+struct csr_inline_read {
+    enum src_e { NONE, PLAIN, CYCLE, INSTRET } src{NONE};
+    //! PLAIN: location of the XLEN wide value
+    void const* ptr{nullptr};
+    //! CYCLE: offset added to the cycle register
+    int64_t const* offset{nullptr};
+    uint64_t divider{1};
+    //! 32 for the upper halves of the counters on RV32
+    unsigned shift{0};
 };
 
-template <typename BASE = logging::disass> struct riscv_hart_common : public BASE, public mem::memory_elem {
+/**
+ * non-templated access to a hart for platform code which does not know the concrete core type, e.g. to add
+ * elements to the memory hierarchy
+ */
+struct riscv_hart_if {
+    virtual ~riscv_hart_if() = default;
+    virtual mem::memory_hierarchy& get_memory_hierarchy() = 0;
+    //! offset added to the executed cycles, memory elements account their latencies here
+    virtual int64_t& get_cycle_offset() = 0;
+    virtual uint64_t const& get_tohost() const = 0;
+    virtual uint64_t const& get_fromhost() const = 0;
+    //! cycles executed by the hart, the total cycle count is this plus the cycle offset
+    virtual uint64_t const& get_cycle_counter() const = 0;
+    //! sets or clears a local interrupt (bit id of mip) and re-evaluates the pending interrupts
+    virtual void set_local_irq(unsigned id, bool value) = 0;
+    /**
+     * handler called on WFI and in idle loops if no enabled interrupt is pending. It gets the value of mie and the max.
+     * number of cycles to skip (unlimited on WFI) and returns the number of cycles it advanced the cycle offset by
+     */
+    virtual void set_wait_handler(std::function<uint64_t(uint64_t, uint64_t)> handler) = 0;
+    //! source of the time CSR, by default it is derived from the cycle counter
+    virtual void set_time_source(std::function<uint64_t()> source) = 0;
+    //! the performance monitor counters, event sources outside the hart count their events here
+    virtual hpm_counters& get_hpm() = 0;
+    //! sets mhartid, used by platforms instantiating several harts
+    virtual void set_mhartid(uint64_t id) = 0;
+    //! makes the main memory of this hart use the content of the one of other, used by platforms instantiating several harts
+    virtual void share_main_memory(riscv_hart_if& other) = 0;
+    //! the current privilege level (0=U, 1=S, 3=M)
+    virtual unsigned get_privilege_level() const = 0;
+    //! selects how the console output of the HTIF syscalls is passed to the host
+    virtual void set_htif_console_mode(htif_console_mode mode) = 0;
+    /**
+     * bulk debug accesses of arbitrary size for debuggers and platform code. The range is split at page boundaries,
+     * each page is translated and copied from or to the backing memory as a whole
+     */
+    virtual iss::status read_debug_range(uint64_t addr, uint64_t length, uint8_t* data) = 0;
+    virtual iss::status write_debug_range(uint64_t addr, uint64_t length, uint8_t const* data) = 0;
+    /**
+     * used by the JIT backends to read CSRs inline. Returns NONE if the CSR is not accessible in the current privilege
+     * mode or needs to go through its callback, the generated code has to check the privilege if it is above user mode
+     */
+    virtual csr_inline_read get_csr_inline_read(unsigned addr) = 0;
+    //! checks if the code at head is an idle loop, used by the JIT backends when translating a block
+    virtual bool is_idle_loop(uint64_t head) = 0;
+    //! called by the VMs when reaching the head of a (potential) idle loop, see idle_loop.h
+    virtual void idle_loop_head(uint64_t head) = 0;
+
+    void set_idle_loop_mode(idle_loop_mode mode) { idle_mode = mode; }
+
+    bool idle_loop_detection() const { return idle_mode != idle_loop_mode::OFF; }
+
+    /**
+     * called by unit-stride vector loads to announce that the following data reads of the instruction read at most
+     * bytes contiguous bytes in ascending order, 0 ends the burst. The memory system may fetch them with one transaction
+     */
+    void announce_read_burst(uint64_t bytes) {
+        if(read_burst_handler)
+            read_burst_handler(bytes);
+    }
+
+    void set_read_burst_handler(std::function<void(uint64_t)> handler) { read_burst_handler = handler; }
+
+protected:
+    idle_loop_mode idle_mode{idle_loop_mode::OFF};
+    std::function<void(uint64_t)> read_burst_handler;
+};
+
+template <typename BASE = logging::disass> struct riscv_hart_common : public BASE, public mem::memory_elem, public riscv_hart_if {
 
     constexpr static unsigned MEM = traits<BASE>::MEM;
 
@@ -319,6 +467,8 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
 
     using rd_csr_f = std::function<iss::status(unsigned addr, reg_t&)>;
     using wr_csr_f = std::function<iss::status(unsigned addr, reg_t)>;
+    using rd_csr_delegate = small_delegate<iss::status(unsigned addr, reg_t&)>;
+    using wr_csr_delegate = small_delegate<iss::status(unsigned addr, reg_t)>;
 
     // Extension status bits (SD needs to be set when any of  FS / VS / XS are dirty [0b11]):
     // TODO implement XS
@@ -449,25 +599,27 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
             csr_rd_cb[vlenb] = MK_CSR_RD_CB(read_vlenb);
         }
         for(unsigned addr = mhpmcounter3; addr <= mhpmcounter31; ++addr) {
-            csr_rd_cb[addr] = MK_CSR_RD_CB(read_null);
-            csr_wr_cb[addr] = MK_CSR_WR_CB(write_plain);
+            csr_rd_cb[addr] = MK_CSR_RD_CB(read_hpm);
+            csr_wr_cb[addr] = MK_CSR_WR_CB(write_hpm);
         }
         if(traits<BASE>::XLEN == 32)
             for(unsigned addr = mhpmcounter3h; addr <= mhpmcounter31h; ++addr) {
-                csr_rd_cb[addr] = MK_CSR_RD_CB(read_null);
-                csr_wr_cb[addr] = MK_CSR_WR_CB(write_plain);
+                csr_rd_cb[addr] = MK_CSR_RD_CB(read_hpm);
+                csr_wr_cb[addr] = MK_CSR_WR_CB(write_hpm);
             }
         for(unsigned addr = mhpmevent3; addr <= mhpmevent31; ++addr) {
-            csr_rd_cb[addr] = MK_CSR_RD_CB(read_null);
-            csr_wr_cb[addr] = MK_CSR_WR_CB(write_plain);
+            csr_rd_cb[addr] = MK_CSR_RD_CB(read_hpm);
+            csr_wr_cb[addr] = MK_CSR_WR_CB(write_hpm);
         }
         for(unsigned addr = hpmcounter3; addr <= hpmcounter31; ++addr) {
-            csr_rd_cb[addr] = MK_CSR_RD_CB(read_null);
+            csr_rd_cb[addr] = MK_CSR_RD_CB(read_hpm);
         }
         if(traits<BASE>::XLEN == 32)
             for(unsigned addr = hpmcounter3h; addr <= hpmcounter31h; ++addr) {
-                csr_rd_cb[addr] = MK_CSR_RD_CB(read_null);
+                csr_rd_cb[addr] = MK_CSR_RD_CB(read_hpm);
             }
+        csr_rd_cb[mcountinhibit] = MK_CSR_RD_CB(read_hpm);
+        csr_wr_cb[mcountinhibit] = MK_CSR_WR_CB(write_hpm);
         // common regs
         const std::array<unsigned, 4> roaddrs{{misa, mvendorid, marchid, mimpid}};
         for(auto addr : roaddrs) {
@@ -498,21 +650,43 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
         if(traits<BASE>::XLEN == 32)
             csr_wr_cb[minstreth] = MK_CSR_WR_CB(write_instret);
         csr_rd_cb[mhartid] = MK_CSR_RD_CB(read_hartid);
+        for(auto addr : {cycle, instret, time, mcycle, minstret, mscratch, mhartid})
+            csr_inline.set(addr);
+        if(traits<BASE>::XLEN == 32)
+            for(auto addr : {cycleh, instreth, timeh, mcycleh, minstreth})
+                csr_inline.set(addr);
+        reservations.add_hart();
     };
 
     virtual ~riscv_hart_common() {
-        if(io_buf.str().length()) {
-            ILOG(isslogger, logging::INFO, fmt::format("tohost send '{}'", io_buf.str()));
+        reservations.release(reservation);
+        reservations.remove_hart();
+        htif.flush();
+        if(!idle_loop_stats.empty()) {
+            uint64_t skipped = 0;
+            for(auto& e : idle_loop_stats) {
+                skipped += e.second.skipped;
+                if(idle_mode == idle_loop_mode::LOG)
+                    ILOG(isslogger, logging::INFO,
+                         fmt::format("idle loop at {:#x}: {} instructions, entered {} times, skipped {} cycles", e.first, e.second.length,
+                                     e.second.count, e.second.skipped));
+            }
+            ILOG(isslogger, logging::INFO, fmt::format("skipped {} cycles in {} idle loop(s)", skipped, idle_loop_stats.size()));
         }
     }
 
+    std::vector<std::unique_ptr<elf_image>> elf_images;
     std::unordered_map<std::string, uint64_t> symbol_table;
+    bool symbol_table_valid{false};
     uint64_t entry_address{0};
     uint64_t tohost = std::numeric_limits<uint64_t>::max();
     uint64_t fromhost = std::numeric_limits<uint64_t>::max();
-    std::stringstream io_buf;
+    htif_syscalls htif{[this](std::string const& msg) { ILOG(isslogger, logging::INFO, msg); },
+                       [this](std::string const& msg) { ILOG(isslogger, logging::WARN, msg); }};
+    bool trap_log_enabled{false};
 
     void enable_disass_output(bool enable) {
+        trap_log_enabled = enable;
         if(enable)
             this->disass_func =
                 util::delegate<void(uint64_t, std::string const&, bool)>::from<this_class, &this_class::print_disass_output>(this);
@@ -527,99 +701,103 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
     }
 
     bool read_elf_file(std::string const& name, uint8_t expected_elf_class) {
-        // Create elfio reader
-        ELFIO::elfio reader;
-        // Load ELF data
-        if(reader.load(name)) {
-            // check elf properties
-            if(reader.get_class() != expected_elf_class) {
-                ILOG(isslogger, logging::ERR, "ISA missmatch, selected XLEN does not match supplied file ");
-                return false;
-            }
-            if(reader.get_type() != ELFIO::ET_EXEC && reader.get_type() != ELFIO::ET_DYN) {
-                ILOG(isslogger, logging::ERR, "Input is neither an executable nor a pie executable (dyn)");
-                return false;
-            }
-            if(reader.get_machine() != ELFIO::EM_RISCV)
-                return false;
-            entry_address = reader.get_entry();
-            for(const auto& pseg : reader.segments) {
-                const auto fsize = pseg->get_file_size(); // 0x42c/0x0
-                const auto seg_data = pseg->get_data();
-                const auto type = pseg->get_type();
-                if(type == ELFIO::PT_LOAD && fsize > 0) {
-                    auto res = this->write(
-                        {iss::address_type::LOGICAL, iss::access_type::DEBUG_WRITE, traits<BASE>::IMEM, pseg->get_physical_address()},
-                        fsize, reinterpret_cast<const uint8_t* const>(seg_data));
-                    if(res != iss::Ok)
-                        ILOG(isslogger, logging::ERR,
-                             fmt::format("problem writing {} bytes to 0x{:x}", fsize, pseg->get_physical_address()));
-                }
-            }
-            const auto sym_sec = reader.sections[".symtab"];
-            if(ELFIO::SHT_SYMTAB == sym_sec->get_type() || ELFIO::SHT_DYNSYM == sym_sec->get_type()) {
-                ELFIO::symbol_section_accessor symbols(reader, sym_sec);
-                auto sym_no = symbols.get_symbols_num();
-                std::string name;
-                ELFIO::Elf64_Addr value = 0;
-                ELFIO::Elf_Xword size = 0;
-                unsigned char bind = 0;
-                unsigned char type = 0;
-                ELFIO::Elf_Half section = 0;
-                unsigned char other = 0;
-                for(auto i = 0U; i < sym_no; ++i) {
-                    symbols.get_symbol(i, name, value, size, bind, type, section, other);
-                    if(name != "") {
-                        this->symbol_table[name] = value;
-#ifndef NDEBUG
-                        ILOG(isslogger, logging::TRACE, fmt::format("Found Symbol {}", name));
-#endif
-                    }
+        using clock = std::chrono::steady_clock;
+        auto const ms = [](clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+        auto const t_start = clock::now();
+        auto image = std::make_unique<elf_image>();
+        if(!image->open(name))
+            return false;
+        // check elf properties
+        if(image->get_class() != expected_elf_class) {
+            ILOG(isslogger, logging::ERR, "ISA missmatch, selected XLEN does not match supplied file ");
+            return false;
+        }
+        if(image->get_type() != ELFIO::ET_EXEC && image->get_type() != ELFIO::ET_DYN) {
+            ILOG(isslogger, logging::ERR, "Input is neither an executable nor a pie executable (dyn)");
+            return false;
+        }
+        if(image->get_machine() != ELFIO::EM_RISCV)
+            return false;
+        entry_address = image->get_entry();
+        auto const t_mapped = clock::now();
+        // segments are copied straight from the file mapping page by page using the bulk debug accesses
+        for(auto const& seg : image->get_load_segments()) {
+            if(write_debug_range(seg.paddr, seg.file_size, seg.data) != iss::Ok)
+                ILOG(isslogger, logging::ERR, fmt::format("problem writing {} bytes to 0x{:x}", seg.file_size, seg.paddr));
+        }
+        auto const t_segments = clock::now();
+        static std::array<uint8_t, debug_page_size> const zeros{};
+        for(auto const& seg : image->get_load_segments()) {
+            for(uint64_t offs = seg.file_size, len = 0; offs < seg.mem_size; offs += len) {
+                len = std::min<uint64_t>(debug_page_size - ((seg.paddr + offs) & (debug_page_size - 1)), seg.mem_size - offs);
+                if(write_debug_range(seg.paddr + offs, len, zeros.data()) != iss::Ok) {
+                    ILOG(isslogger, logging::ERR, fmt::format("problem clearing {} bytes at 0x{:x}", seg.mem_size - offs, seg.paddr + offs));
+                    break;
                 }
-                auto to_it = symbol_table.find("tohost");
-                if(to_it != std::end(symbol_table))
-                    tohost = to_it->second;
-                auto from_it = symbol_table.find("tohost");
-                if(from_it != std::end(symbol_table))
-                    tohost = from_it->second;
             }
-            return true;
         }
-        return false;
+        auto const t_bss = clock::now();
+        // the full symbol index is only built if somebody asks for it
+        if(auto addr = image->find_symbol("tohost"))
+            tohost = *addr;
+        if(auto addr = image->find_symbol("fromhost"))
+            fromhost = *addr;
+        // the program break of the brk() syscall starts behind the image
+        if(auto addr = image->find_symbol("_end"))
+            htif.set_heap_start(*addr);
+        else
+            for(auto const& seg : image->get_load_segments())
+                htif.set_heap_start(seg.paddr + seg.mem_size);
+        auto const t_symbols = clock::now();
+        elf_images.push_back(std::move(image));
+        symbol_table_valid = false;
+        ILOG(isslogger, logging::INFO,
+             fmt::format("loaded {} in {:.3f}ms (mapping {:.3f}ms, segments {:.3f}ms, bss {:.3f}ms, symbols {:.3f}ms)", name,
+                         ms(t_symbols - t_start), ms(t_mapped - t_start), ms(t_segments - t_mapped), ms(t_bss - t_segments),
+                         ms(t_symbols - t_bss)));
+        return true;
     };
 
-    iss::status execute_sys_write(arch_if* aif, const std::array<uint64_t, 8>& loaded_payload, unsigned mem_type) {
-        uint64_t fd = loaded_payload[1];
-        uint64_t buf_ptr = loaded_payload[2];
-        uint64_t len = loaded_payload[3];
-        std::vector<char> buf(len);
-        if(aif->read({address_type::LOGICAL, access_type::DEBUG_READ, mem_type, buf_ptr}, len, reinterpret_cast<uint8_t*>(buf.data()))) {
-            ILOG(isslogger, logging::ERR, "SYS_WRITE buffer read went wrong");
-            return iss::Err;
-        }
-        // we disregard the fd and just log to stdout
-        for(size_t i = 0; i < len; i++) {
-            if(buf[i] == '\n' || buf[i] == '\0') {
-                ILOG(isslogger, logging::INFO, fmt::format("tohost send '{}'", io_buf.str()));
-                io_buf.str("");
-            } else
-                io_buf << buf[i];
+    //! symbols of all loaded ELF files by name, built on first use
+    std::unordered_map<std::string, uint64_t> const& get_symbol_table() {
+        if(elf_images.size() == 1)
+            return elf_images.front()->get_symbol_table();
+        if(!symbol_table_valid) {
+            symbol_table.clear();
+            for(auto& image : elf_images)
+                for(auto& e : image->get_symbol_table())
+                    symbol_table[e.first] = e.second;
+            symbol_table_valid = true;
         }
+        return symbol_table;
+    }
 
-        // Not sure what the correct return value should be
-        uint8_t ret_val = 1;
-        if(fromhost != std::numeric_limits<uint64_t>::max())
-            if(aif->write({address_type::LOGICAL, access_type::DEBUG_WRITE, mem_type, fromhost}, 1, &ret_val) != iss::Ok) {
-                ILOG(isslogger, logging::ERR, "Fromhost write went wrong");
-                return iss::Err;
-            }
-        return iss::Ok;
+    //! executes the syscall in the HTIF magic memory at magic_mem, stops the simulation if the target exits
+    iss::status execute_htif_syscall(arch_if* aif, uint64_t magic_mem, unsigned mem_type) {
+        auto res = htif.execute(aif, mem_type, magic_mem, fromhost);
+        if(res != iss::Ok)
+            ILOG(isslogger, logging::ERR, fmt::format("HTIF syscall at 0x{:x} could not access the memory", magic_mem));
+        if(auto code = htif.get_exit_code()) {
+            if(*code)
+                ILOG(isslogger, logging::ERR, fmt::format("target called exit({}), stopping simulation", *code));
+            else
+                ILOG(isslogger, logging::INFO, "target called exit(0), stopping simulation");
+            this->reg.trap_state = std::numeric_limits<uint32_t>::max();
+            this->interrupt_sim = static_cast<uint64_t>(*code) << 1 | 1;
+        }
+        return res;
     }
 
     constexpr bool has_compressed() { return traits<BASE>::MISA_VAL & 0b0100; }
 
     constexpr reg_t get_pc_mask() { return has_compressed() ? (reg_t)~1 : (reg_t)~3; }
 
+    //! emits the message created by msg only if the disassembly output is enabled, so traps do not pay for formatting
+    template <typename F> void trap_log(F&& msg) {
+        if(unlikely(trap_log_enabled))
+            this->disass_output(msg());
+    }
+
     void print_disass_output(uint64_t pc, std::string const& string, bool printpc) {
         static CONSTEXPR char const* fmt_str =
             sizeof(reg_t) == 4 ? "0x{:08x}    {:40} [p:{};s:0x{:02x};i:{};c:{}]" : "0x{:012x}    {:40} [p:{};s:0x{:04x};i:{};c:{}]";
@@ -631,19 +809,30 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
         }
     };
 
-    void register_csr(unsigned addr, rd_csr_f f) { csr_rd_cb[addr] = f; }
-    void register_csr(unsigned addr, wr_csr_f f) { csr_wr_cb[addr] = f; }
+    // externally registered callbacks are kept here so that the dispatch table can refer to them
+    void register_csr(unsigned addr, rd_csr_f f) {
+        auto* fp = &ext_csr_rd_cb.emplace_back(std::move(f));
+        csr_rd_cb.at(addr) = [fp](unsigned a, reg_t& r) -> iss::status { return (*fp)(a, r); };
+        csr_inline.reset(addr);
+    }
+    void register_csr(unsigned addr, wr_csr_f f) {
+        auto* fp = &ext_csr_wr_cb.emplace_back(std::move(f));
+        csr_wr_cb.at(addr) = [fp](unsigned a, reg_t r) -> iss::status { return (*fp)(a, r); };
+    }
     void register_csr(unsigned addr, rd_csr_f rdf, wr_csr_f wrf) {
-        csr_rd_cb[addr] = rdf;
-        csr_wr_cb[addr] = wrf;
+        register_csr(addr, std::move(rdf));
+        register_csr(addr, std::move(wrf));
+    }
+    void unregister_csr_rd(unsigned addr) {
+        csr_rd_cb.at(addr) = nullptr;
+        csr_inline.reset(addr);
     }
-    void unregister_csr_rd(unsigned addr) { csr_rd_cb.erase(addr); }
-    void unregister_csr_wr(unsigned addr) { csr_wr_cb.erase(addr); }
+    void unregister_csr_wr(unsigned addr) { csr_wr_cb.at(addr) = nullptr; }
 
     bool debug_mode_active() { return this->reg.PRIV & 0x4; }
 
     const reg_t& get_mhartid() const { return mhartid_reg; }
-    void set_mhartid(reg_t mhartid) { mhartid_reg = mhartid; };
+    void set_mhartid(uint64_t mhartid) override { mhartid_reg = mhartid; };
 
     void add_debug_csrs() {
         this->csr_wr_cb[dscratch0] = MK_CSR_WR_CB(write_dscratch);
@@ -676,11 +865,11 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
             this->reg.trap_state = (1U << 31) | traits<BASE>::RV_CAUSE_ILLEGAL_INSTRUCTION << 16;
             return iss::Err;
         }
-        auto it = csr_rd_cb.find(addr);
-        if(it == csr_rd_cb.end() || !it->second) { // non existent register
+        auto const& cb = csr_rd_cb[addr];
+        if(!cb) { // non existent register
             return iss::Err;
         }
-        return it->second(addr, val);
+        return cb(addr, val);
     }
 
     iss::status write_csr(unsigned addr, reg_t val) {
@@ -697,12 +886,12 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
             this->reg.trap_state = (1U << 31) | traits<BASE>::RV_CAUSE_ILLEGAL_INSTRUCTION << 16;
             return iss::Err;
         }
-        auto it = csr_wr_cb.find(addr);
-        if(it == csr_wr_cb.end() || !it->second) { // non existent register
+        auto const& cb = csr_wr_cb[addr];
+        if(!cb) { // non existent register
             this->reg.trap_state = (1U << 31) | traits<BASE>::RV_CAUSE_ILLEGAL_INSTRUCTION << 16;
             return iss::Err;
         }
-        return it->second(addr, val);
+        return cb(addr, val);
     }
 
     iss::status read_null(unsigned addr, reg_t& val) {
@@ -722,6 +911,32 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
         return iss::Ok;
     }
 
+    iss::status read_hpm(unsigned addr, reg_t& val) {
+        if(addr == mcountinhibit)
+            val = hpm.get_inhibit();
+        else if(addr >= mhpmevent3 && addr <= mhpmevent31)
+            val = static_cast<reg_t>(hpm.get_event(addr & 0x1f));
+        else if(addr & 0x80) // mhpmcounterXh, hpmcounterXh
+            val = static_cast<reg_t>(hpm.get_counter(addr & 0x1f) >> 32);
+        else
+            val = static_cast<reg_t>(hpm.get_counter(addr & 0x1f));
+        return iss::Ok;
+    }
+
+    iss::status write_hpm(unsigned addr, reg_t val) {
+        if(addr == mcountinhibit)
+            hpm.set_inhibit(val & ~0x7U); // mcycle and minstret cannot be inhibited
+        else if(addr >= mhpmevent3 && addr <= mhpmevent31)
+            hpm.set_event(addr & 0x1f, val);
+        else if(traits<BASE>::XLEN == 32 && (addr & 0x80))
+            hpm.set_counter(addr & 0x1f, (hpm.get_counter(addr & 0x1f) & 0xffffffffULL) | static_cast<uint64_t>(val) << 32);
+        else if(traits<BASE>::XLEN == 32)
+            hpm.set_counter(addr & 0x1f, (hpm.get_counter(addr & 0x1f) & ~0xffffffffULL) | val);
+        else
+            hpm.set_counter(addr & 0x1f, val);
+        return iss::Ok;
+    }
+
     iss::status read_cycle(unsigned addr, reg_t& val) {
         auto cycle_val = this->reg.cycle + cycle_offset;
         if(addr == mcycle || addr == cycle) {
@@ -772,7 +987,7 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
     }
 
     iss::status read_time(unsigned addr, reg_t& val) {
-        uint64_t time_val = this->reg.cycle / (100000000 / 32768 - 1); //-> ~3052;
+        uint64_t time_val = time_source ? time_source() : (this->reg.cycle + cycle_offset) / (100000000 / 32768 - 1); //-> ~3052;
         if(addr == time) {
             val = static_cast<reg_t>(time_val);
         } else if(addr == timeh) {
@@ -958,7 +1173,8 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
             .PC{this->reg.PC},
             .tohost{this->tohost},
             .fromhost{this->fromhost},
-            .max_irq{mcause_max_irq}};
+            .max_irq{mcause_max_irq},
+            .hpm{this->hpm}};
     }
 
     iss::status execute_htif(uint8_t const* data, unsigned length) {
@@ -983,20 +1199,7 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
             this->interrupt_sim = payload_data;
             return iss::Ok;
         } else if(device == 0 && command == 0) {
-            std::array<uint64_t, 8> loaded_payload;
-            if(memory.rd_mem({address_type::LOGICAL, access_type::DEBUG_READ, traits<BASE>::MEM, payload_data}, 8 * sizeof(uint64_t),
-                             reinterpret_cast<uint8_t*>(loaded_payload.data())) == iss::Err)
-                ILOG(isslogger, logging::ERR, "Syscall read went wrong");
-            uint64_t syscall_num = loaded_payload.at(0);
-            if(syscall_num == 64) { // SYS_WRITE
-                return this->execute_sys_write(this, loaded_payload, traits<BASE>::MEM);
-            } else {
-                ILOG(isslogger, logging::ERR,
-                     fmt::format("this->tohost syscall with number 0x{:x} ({}) not implemented", syscall_num, syscall_num));
-                this->reg.trap_state = std::numeric_limits<uint32_t>::max();
-                this->interrupt_sim = payload_data;
-                return iss::Ok;
-            }
+            return execute_htif_syscall(this, payload_data, traits<BASE>::MEM);
         } else {
             ILOG(isslogger, logging::ERR,
                  fmt::format("this->tohost functionality not implemented for device {} and command {}", device, command));
@@ -1008,6 +1211,108 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
 
     mem::memory_hierarchy memories;
 
+    mem::memory_hierarchy& get_memory_hierarchy() override { return memories; }
+
+    int64_t& get_cycle_offset() override { return cycle_offset; }
+
+    uint64_t const& get_tohost() const override { return tohost; }
+
+    uint64_t const& get_fromhost() const override { return fromhost; }
+
+    uint64_t const& get_cycle_counter() const override { return this->reg.cycle; }
+
+    hpm_counters& get_hpm() override { return hpm; }
+
+    unsigned get_privilege_level() const override { return this->reg.PRIV; }
+
+    void set_htif_console_mode(htif_console_mode mode) override { htif.set_console_mode(mode); }
+
+    //! granularity of the bulk debug accesses, the smallest MMU page
+    static constexpr uint64_t debug_page_size = 4096;
+
+    iss::status read_debug_range(uint64_t addr, uint64_t length, uint8_t* data) override {
+        for(uint64_t offs = 0, len = 0; offs < length; offs += len) {
+            len = std::min<uint64_t>(debug_page_size - ((addr + offs) & (debug_page_size - 1)), length - offs);
+            if(this->read({address_type::LOGICAL, access_type::DEBUG_READ, traits<BASE>::MEM, addr + offs}, len, data + offs) != iss::Ok)
+                return iss::Err;
+        }
+        return iss::Ok;
+    }
+
+    iss::status write_debug_range(uint64_t addr, uint64_t length, uint8_t const* data) override {
+        for(uint64_t offs = 0, len = 0; offs < length; offs += len) {
+            len = std::min<uint64_t>(debug_page_size - ((addr + offs) & (debug_page_size - 1)), length - offs);
+            auto res = this->write({address_type::LOGICAL, access_type::DEBUG_WRITE, traits<BASE>::MEM, addr + offs}, len, data + offs);
+            if(res != iss::Ok)
+                return iss::Err;
+        }
+        return iss::Ok;
+    }
+
+    void set_wait_handler(std::function<uint64_t(uint64_t, uint64_t)> handler) override { wait_handler = handler; }
+
+    void set_time_source(std::function<uint64_t()> source) override { time_source = source; }
+
+    csr_inline_read get_csr_inline_read(unsigned addr) override {
+        if(addr >= csr_inline.size() || !csr_inline[addr] || this->reg.PRIV < ((addr >> 8) & 0x3))
+            return {};
+        unsigned const shift = addr & 0x80 ? 32 : 0; // cycleh, instreth, timeh, mcycleh, minstreth
+        switch(addr & ~0x80U) {
+        case cycle:
+        case mcycle:
+            return {.src = csr_inline_read::CYCLE, .offset = &cycle_offset, .shift = shift};
+        case instret:
+        case minstret:
+            return {.src = csr_inline_read::INSTRET, .shift = shift};
+        case time:
+            if(time_source)
+                return {};
+            return {.src = csr_inline_read::CYCLE, .offset = &cycle_offset, .divider = 100000000 / 32768 - 1, .shift = shift};
+        case mscratch:
+            return {.src = csr_inline_read::PLAIN, .ptr = &csr[mscratch]};
+        case mhartid:
+            return {.src = csr_inline_read::PLAIN, .ptr = &mhartid_reg};
+        default:
+            return {};
+        }
+    }
+
+    void wait_until(uint64_t flags) override {
+        if(wait_handler && !(csr[mip] & csr[mie]))
+            wait_handler(csr[mie], std::numeric_limits<uint64_t>::max());
+    }
+
+    bool is_idle_loop(uint64_t head) override { return get_idle_loop_entry(head).length != 0; }
+
+    void idle_loop_head(uint64_t head) override {
+        auto& e = get_idle_loop_entry(head);
+        auto const icount = this->reg.icount;
+        // only back-to-back iterations of the same loop count, anything else (e.g. a trap) restarts the detection
+        if(e.length && head == idle_loop_last_head && icount - idle_loop_last_icount == e.length) {
+            if(++idle_loop_iterations == 1)
+                idle_loop_start = this->reg.cycle + cycle_offset;
+            else if(idle_loop_iterations == 2) {
+                // the cached result may be stale if the code has been modified
+                if((e.length = analyze_idle_loop<traits<BASE>::XLEN>(head, idle_loop_fetch))) {
+                    auto& stat = idle_loop_stats[head];
+                    stat.length = e.length;
+                    stat.count++;
+                    if(idle_mode == idle_loop_mode::LOG)
+                        ILOG(isslogger, logging::INFO, fmt::format("idle loop detected at {:#x} ({} instructions)", head, e.length));
+                }
+            }
+            if(idle_loop_iterations >= 2 && e.length && !(csr[mip] & csr[mie])) {
+                // the inputs of the loop may be counters, so the time is advanced in steps of 1/8 of the time already
+                // spent in the loop. This bounds the overshoot of loops waiting for a certain counter value
+                auto const elapsed = this->reg.cycle + cycle_offset - idle_loop_start;
+                idle_loop_stats[head].skipped += skip_idle_cycles(std::max<uint64_t>(elapsed / 8, e.length));
+            }
+        } else
+            idle_loop_iterations = 0;
+        idle_loop_last_head = head;
+        idle_loop_last_icount = icount;
+    }
+
     mem::memory_if get_mem_if() override {
         assert(false || "This function should never be called");
         return mem::memory_if{};
@@ -1015,6 +1320,86 @@ template <typename BASE = logging::disass> struct riscv_hart_common : public BAS
 
     void set_next(mem::memory_if mem_if) override { memory = mem_if; };
 
+    //! checks if a data access is done by an LR, SC or AMO, the instruction word is written by the VMs for these
+    bool is_atomic_access(access_type access) const {
+        return !is_debug(access) && !is_fetch(access) && (this->reg.instruction & 0x7f) == 0x2f;
+    }
+
+    /**
+     * reads memory for an LR or AMO. LR takes the reservation before loading the data, AMOs are performed by the memory
+     * as a whole if it supports it. The MMU and PMP check the write permission of an AMO already with its read, so a
+     * faulting AMO leaves the memory untouched. The write following the read then only checks the access rights again
+     */
+    iss::status atomic_rd_mem(iss::addr_t const& a, unsigned length, uint8_t* data) {
+        auto const instr = this->reg.instruction;
+        auto const funct5 = instr >> 27;
+        if(!is_atomic_instr(instr, a.val, length))
+            return memory.rd_mem(a, length, data);
+        if(funct5 == 0b00010) {
+            reservations.reserve(reservation, a.val);
+            auto res = memory.rd_mem(a, length, data);
+            reservation.value = 0;
+            std::memcpy(&reservation.value, data, length);
+            return res;
+        }
+        static constexpr std::array<mem::atomic_op::op_e, 8> amo_ops{mem::atomic_op::ADD, mem::atomic_op::XOR, mem::atomic_op::OR,
+                                                                      mem::atomic_op::AND, mem::atomic_op::MIN, mem::atomic_op::MAX,
+                                                                      mem::atomic_op::MINU, mem::atomic_op::MAXU};
+        amo = {.op = funct5 == 0b00001 ? mem::atomic_op::SWAP : amo_ops[funct5 >> 2], .operand = get_x((instr >> 20) & 31)};
+        mem::current_atomic = &amo;
+        auto res = memory.rd_mem(a, length, data);
+        mem::current_atomic = nullptr;
+        if(res == iss::Ok && amo.done) {
+            std::memcpy(data, &amo.result, length);
+            pending_store = pending_store_e::DISCARD;
+            reservations.notify_store(a.val, length);
+        }
+        return res;
+    }
+
+    //! writes memory for an AMO or SC whose memory update has been performed already
+    iss::status atomic_wr_mem(iss::addr_t const& a, unsigned length, uint8_t const* data) {
+        auto const pending = pending_store;
+        pending_store = pending_store_e::NONE;
+        if(pending == pending_store_e::SKIP)
+            return iss::Ok;
+        mem::atomic_op discard{.op = mem::atomic_op::DISCARD};
+        mem::current_atomic = &discard;
+        auto res = memory.wr_mem(a, length, data);
+        mem::current_atomic = nullptr;
+        return res;
+    }
+
+    /**
+     * read of the reservation by SC. If the reservation is valid the store is performed as compare and swap against
+     * the value loaded by LR, the VM skips its own store if this fails
+     */
+    iss::status store_conditional(iss::addr_t const& a, unsigned length, uint8_t* data) {
+        auto const instr = this->reg.instruction;
+        auto const width = ((instr >> 12) & 7) == 3 ? 8U : 4U;
+        auto ok = reservations.check(reservation, a.val);
+        if(ok && is_atomic_instr(instr, a.val, width) && (instr >> 27) == 0b00011) {
+            auto const val = get_x((instr >> 20) & 31);
+            mem::atomic_op cas{.op = mem::atomic_op::CAS, .operand = val, .expected = reservation.value};
+            mem::current_atomic = &cas;
+            auto res = this->write({a.type, access_type::WRITE, traits<BASE>::MEM, a.val}, width, reinterpret_cast<uint8_t const*>(&val));
+            mem::current_atomic = nullptr;
+            if(res != iss::Ok)
+                return res;
+            ok = !cas.done || (cas.result ^ cas.expected) << (64 - 8 * width) == 0;
+            if(ok)
+                pending_store = pending_store_e::SKIP;
+        }
+        std::memset(data, ok ? 0xff : 0, length);
+        return iss::Ok;
+    }
+
+    //! write of the reservation by LR, the reservation is normally taken when LR reads the data already
+    void load_reserved(uint64_t addr) {
+        if(!reservation.valid || reservation.line != addr >> mem::reservation_table::line_bits)
+            reservations.reserve(reservation, addr);
+    }
+
     void set_max_irq_num(unsigned i) { mcause_max_irq = std::max(1u << util::ilog2(i), 16u); }
 
     void set_clint_custom_irq_num(unsigned num) {
@@ -1026,6 +1411,36 @@ protected:
     util::InstanceLogger<logging::dbt_rise_iss> isslogger;
     hart_state<reg_t> state;
 
+    /**
+     * advances the cycle count of an idle hart by up to max_cycles, stopping at the next event. Returns the number of
+     * cycles skipped
+     */
+    virtual uint64_t skip_idle_cycles(uint64_t max_cycles) {
+        if(wait_handler)
+            return wait_handler(csr[mie], max_cycles);
+        cycle_offset += max_cycles;
+        return max_cycles;
+    }
+
+    struct idle_loop_entry {
+        uint64_t head{std::numeric_limits<uint64_t>::max()};
+        unsigned length{0};
+    };
+
+    idle_loop_entry& get_idle_loop_entry(uint64_t head) {
+        auto& e = idle_loop_cache[(head >> 1) % idle_loop_cache.size()];
+        if(e.head != head) {
+            e.head = head;
+            e.length = analyze_idle_loop<traits<BASE>::XLEN>(head, idle_loop_fetch);
+        }
+        return e;
+    }
+
+    std::function<bool(uint64_t, uint32_t&)> idle_loop_fetch = [this](uint64_t addr, uint32_t& insn) {
+        return this->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, traits<BASE>::IMEM, addr}, 4,
+                          reinterpret_cast<uint8_t*>(&insn)) == iss::Ok;
+    };
+
     mem::memory_if memory;
     struct riscv_instrumentation_if : public iss::instrumentation_if {
 
@@ -1058,7 +1473,7 @@ protected:
 
         unsigned get_reg_size(unsigned num) override { return traits<BASE>::reg_bit_widths[num]; }
 
-        std::unordered_map<std::string, uint64_t> const& get_symbol_table(std::string name) override { return arch.symbol_table; }
+        std::unordered_map<std::string, uint64_t> const& get_symbol_table(std::string name) override { return arch.get_symbol_table(); }
 
         riscv_hart_common<BASE>& arch;
     };
@@ -1071,9 +1486,15 @@ protected:
     using csr_type = std::array<typename traits<BASE>::reg_t, 1ULL << 12>;
     csr_type csr{0};
 
-    std::unordered_map<unsigned, rd_csr_f> csr_rd_cb;
-    std::unordered_map<unsigned, wr_csr_f> csr_wr_cb;
+    // dispatch tables indexed by the CSR address, empty entries denote non-existent registers
+    std::array<rd_csr_delegate, 1ULL << 12> csr_rd_cb;
+    std::array<wr_csr_delegate, 1ULL << 12> csr_wr_cb;
+    std::deque<rd_csr_f> ext_csr_rd_cb;
+    std::deque<wr_csr_f> ext_csr_wr_cb;
+    //! CSRs which may be read inline by translated code, see get_csr_inline_read()
+    std::bitset<4096> csr_inline;
 
+    hpm_counters hpm;
     reg_t mhartid_reg{0x0};
     uint64_t mcycle_csr{0};
     uint64_t minstret_csr{0};
@@ -1082,8 +1503,36 @@ protected:
     int64_t cycle_offset{0};
     int64_t instret_offset{0};
     semihosting_cb_t<reg_t> semihosting_cb;
+    std::function<uint64_t(uint64_t, uint64_t)> wait_handler;
+    std::function<uint64_t()> time_source;
+    struct idle_loop_stat {
+        unsigned length{0};
+        uint64_t count{0};
+        uint64_t skipped{0};
+    };
+    std::array<idle_loop_entry, 64> idle_loop_cache;
+    std::unordered_map<uint64_t, idle_loop_stat> idle_loop_stats;
+    uint64_t idle_loop_last_head{std::numeric_limits<uint64_t>::max()};
+    uint64_t idle_loop_last_icount{0};
+    uint64_t idle_loop_start{0};
+    unsigned idle_loop_iterations{0};
     unsigned mcause_max_irq{traits<BASE>::XLEN};
     reg_t clint_custom_irq_mask{0xffff};
+    //! LR/SC and AMO state, see mem/atomic.h
+    mem::reservation_table& reservations{mem::reservation_table::instance()};
+    mem::reservation_table::reservation reservation;
+    mem::atomic_op amo;
+    enum class pending_store_e { NONE, DISCARD, SKIP } pending_store{pending_store_e::NONE};
+
+private:
+    reg_t get_x(unsigned idx) const { return reinterpret_cast<reg_t const*>(&this->reg.X0)[idx]; }
+
+    //! checks that the instruction is an LR, SC or AMO of the given width accessing addr
+    bool is_atomic_instr(uint32_t instr, uint64_t addr, unsigned length) const {
+        auto const funct3 = (instr >> 12) & 7;
+        return (instr & 0x7f) == 0x2f && (funct3 == 2 || funct3 == 3) && length == (funct3 == 2 ? 4U : 8U) &&
+               static_cast<reg_t>(addr) == get_x((instr >> 15) & 31);
+    }
 };
 
 } // namespace arch
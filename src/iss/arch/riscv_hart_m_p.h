@@ -88,8 +88,17 @@ public:
 
     void set_csr(unsigned addr, reg_t val) { this->csr[addr] = val; }
 
+    void set_local_irq(unsigned id, bool value) override {
+        if(value)
+            this->csr[mip] |= reg_t(1) << id;
+        else
+            this->csr[mip] &= ~(reg_t(1) << id);
+        check_interrupt();
+    }
+
+    void share_main_memory(riscv_hart_if& other) override { default_mem.share_storage(other.get_memory_hierarchy().last()); }
+
 protected:
-    std::unordered_map<uint64_t, uint8_t> atomic_reservation;
 
     iss::status read_status(unsigned addr, reg_t& val);
     iss::status write_status(unsigned addr, reg_t val);
@@ -155,46 +164,37 @@ iss::status riscv_hart_m_p<BASE, FEAT>::read(const addr_t& a, const unsigned len
                 return iss::Ok;
             }
         } break;
-        case traits<BASE>::RES: {
-            auto it = atomic_reservation.find(addr);
-            if(it != atomic_reservation.end() && it->second != 0) {
-                memset(data, 0xff, length);
-                atomic_reservation.erase(addr);
-            } else
-                memset(data, 0, length);
-        } break;
+        case traits<BASE>::RES:
+            return this->store_conditional(a, length, data);
         default: {
             auto alignment = is_fetch(access) ? (this->has_compressed() ? 2 : 4) : std::min<unsigned>(length, sizeof(reg_t));
             if(unlikely(is_fetch(access) && (addr & (alignment - 1)))) {
-                this->fault_data = addr;
                 if(is_debug(access))
-                    throw trap_access(0, addr);
+                    return iss::Err;
+                this->fault_data = addr;
                 this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_MISALIGNED_FETCH << 16;
                 return iss::Err;
             }
-            try {
-                if(!is_debug(access) && (addr & (alignment - 1))) {
-                    this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_MISALIGNED_LOAD << 16;
-                    this->fault_data = addr;
-                    return iss::Err;
-                }
-                auto res = this->memory.rd_mem({address_type::PHYSICAL, a.access, a.space, a.val}, length, data);
-                if(unlikely(res != iss::Ok && (access & access_type::DEBUG) == 0)) {
-                    this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_LOAD_ACCESS << 16;
-                    this->fault_data = addr;
-                }
-                return res;
-            } catch(trap_access& ta) {
-                if((access & access_type::DEBUG) == 0) {
-                    this->reg.trap_state = (1UL << 31) | ta.id;
-                    this->fault_data = ta.addr;
-                }
+            if(!is_debug(access) && (addr & (alignment - 1))) {
+                this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_MISALIGNED_LOAD << 16;
+                this->fault_data = addr;
                 return iss::Err;
             }
+            auto const prev_trap_state = this->reg.trap_state;
+            auto res = likely(!this->is_atomic_access(access))
+                           ? this->memory.rd_mem({address_type::PHYSICAL, a.access, a.space, a.val}, length, data)
+                           : this->atomic_rd_mem({address_type::PHYSICAL, a.access, a.space, a.val}, length, data);
+            // elements of the memory hierarchy raise specific traps themselves, only fill in a generic access fault
+            if(unlikely(res != iss::Ok && !is_debug(access) && this->reg.trap_state == prev_trap_state)) {
+                this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_LOAD_ACCESS << 16;
+                this->fault_data = addr;
+            }
+            return res;
         } break;
         }
         return iss::Ok;
     } catch(trap_access& ta) {
+        // memory elements not part of this library may still signal faults by throwing
         if((access & access_type::DEBUG) == 0) {
             this->reg.trap_state = (1UL << 31) | ta.id;
             this->fault_data = ta.addr;
@@ -250,40 +250,41 @@ iss::status riscv_hart_m_p<BASE, FEAT>::write(const addr_t& a, const unsigned le
             default:
                 return iss::Ok;
             }
-        }
+        } break;
         case traits<BASE>::RES: {
-            atomic_reservation[addr] = data[0];
+            this->load_reserved(addr);
         } break;
         default: {
             if(unlikely(is_fetch(access) && (addr & 0x1) == 1)) {
+                if(is_debug(access))
+                    return iss::Err;
                 this->fault_data = addr;
-                if(access && access_type::DEBUG)
-                    throw trap_access(0, addr);
                 this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_MISALIGNED_FETCH << 16;
                 return iss::Err;
             }
-            try {
-                auto alignment = std::min<unsigned>(length, sizeof(reg_t));
-                if(length > 1 && (addr & (alignment - 1)) && !is_debug(access)) {
-                    this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_MISALIGNED_STORE << 16;
-                    this->fault_data = addr;
-                    return iss::Err;
-                }
-                auto res = this->memory.wr_mem({address_type::PHYSICAL, a.access, a.space, a.val}, length, data);
-                if(unlikely(res != iss::Ok && !is_debug(access))) {
-                    this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_STORE_ACCESS << 16;
-                    this->fault_data = addr;
-                }
-                return res;
-            } catch(trap_access& ta) {
-                this->reg.trap_state = (1UL << 31) | ta.id;
-                this->fault_data = ta.addr;
+            auto alignment = std::min<unsigned>(length, sizeof(reg_t));
+            if(length > 1 && (addr & (alignment - 1)) && !is_debug(access)) {
+                this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_MISALIGNED_STORE << 16;
+                this->fault_data = addr;
                 return iss::Err;
             }
+            auto const prev_trap_state = this->reg.trap_state;
+            auto res = likely(this->pending_store == base::pending_store_e::NONE)
+                           ? this->memory.wr_mem({address_type::PHYSICAL, a.access, a.space, a.val}, length, data)
+                           : this->atomic_wr_mem({address_type::PHYSICAL, a.access, a.space, a.val}, length, data);
+            // elements of the memory hierarchy raise specific traps themselves, only fill in a generic access fault
+            if(unlikely(res != iss::Ok && !is_debug(access) && this->reg.trap_state == prev_trap_state)) {
+                this->reg.trap_state = (1UL << 31) | traits<BASE>::RV_CAUSE_STORE_ACCESS << 16;
+                this->fault_data = addr;
+            }
+            if(res == iss::Ok && !is_debug(access))
+                this->reservations.notify_store(addr, length);
+            return res;
         } break;
         }
         return iss::Ok;
     } catch(trap_access& ta) {
+        // memory elements not part of this library may still signal faults by throwing
         if((access & access_type::DEBUG) == 0) {
             this->reg.trap_state = (1UL << 31) | ta.id;
             this->fault_data = ta.addr;
@@ -332,7 +333,7 @@ template <typename BASE, features_e FEAT> void riscv_hart_m_p<BASE, FEAT>::check
     // Multiple simultaneous interrupts and traps at the same privilege level are
     // handled in the following decreasing priority order:
     // external interrupts, software interrupts, timer interrupts, then finally
-    // any synchronous traps.
+    // any synchronous traps, see select_interrupt().
     auto ena_irq = this->csr[mip] & this->csr[mie];
 
     bool mstatus_mie = this->state.mstatus.MIE;
@@ -340,12 +341,7 @@ template <typename BASE, features_e FEAT> void riscv_hart_m_p<BASE, FEAT>::check
     auto enabled_interrupts = m_enabled ? ena_irq : 0;
 
     if(enabled_interrupts != 0) {
-        int res = 0;
-        while((enabled_interrupts & 1) == 0) {
-            enabled_interrupts >>= 1;
-            res++;
-        }
-        this->reg.pending_trap = res << 16 | 1; // 0x80 << 24 | (cause << 16) | trap_id
+        this->reg.pending_trap = select_interrupt(enabled_interrupts) << 16 | 1; // 0x80 << 24 | (cause << 16) | trap_id
     }
 }
 
@@ -354,6 +350,7 @@ template <typename BASE, features_e FEAT> uint64_t riscv_hart_m_p<BASE, FEAT>::e
     // calculate and write mcause val
     auto const trap_id = bit_sub<0, 16>(flags);
     auto cause = bit_sub<16, 15>(flags);
+    this->hpm.count(trap_id == 0 ? HPM_EXCEPTION : HPM_INTERRUPT);
     // calculate effective privilege level
     unsigned new_priv = PRIV_M;
     if(trap_id == 0) { // exception
@@ -397,13 +394,7 @@ template <typename BASE, features_e FEAT> uint64_t riscv_hart_m_p<BASE, FEAT>::e
                 if(data == ref_data) {
                     this->reg.NEXT_PC = addr + 8;
 
-                    std::array<char, 32> buffer;
-#if defined(_MSC_VER)
-                    sprintf(buffer.data(), "0x%016llx", addr);
-#else
-                    sprintf(buffer.data(), "0x%016lx", addr);
-#endif
-                    this->disass_output(fmt::format("Semihosting call at address {} occurred ", buffer.data()));
+                    this->trap_log([addr]() { return fmt::format("Semihosting call at address 0x{:016x} occurred ", addr); });
                     this->semihosting_cb(this, &(this->reg.X10) /*a0*/, &(this->reg.X11) /*a1*/);
                     return this->reg.NEXT_PC;
                 }
@@ -452,21 +443,14 @@ template <typename BASE, features_e FEAT> uint64_t riscv_hart_m_p<BASE, FEAT>::e
         if((xtvec & 0x1) == 1 && trap_id != 0)
             this->reg.NEXT_PC += 4 * cause;
     }
-    std::array<char, 32> buffer;
-#if defined(_MSC_VER)
-    sprintf(buffer.data(), "0x%016llx", addr);
-#else
-    sprintf(buffer.data(), "0x%016lx", addr);
-#endif
-    if((flags & 0xffffffff) != 0xffffffff) {
-        if(trap_id) {
-            auto irq_str = cause < this->irq_str.size() ? this->irq_str.at(cause) : "Unknown";
-            this->disass_output(fmt::format("Interrupt with cause '{}' ({}) occurred  at address {}", irq_str, cause, buffer.data()));
-        } else {
-            auto irq_str = cause < this->trap_str.size() ? this->trap_str.at(cause) : "Unknown";
-            this->disass_output(fmt::format("Trap with cause '{}' ({}) occurred  at address {}", irq_str, cause, buffer.data()));
-        }
-    }
+    if((flags & 0xffffffff) != 0xffffffff)
+        this->trap_log([&]() {
+            if(trap_id)
+                return fmt::format("Interrupt with cause '{}' ({}) occurred  at address 0x{:016x}",
+                                   cause < this->irq_str.size() ? this->irq_str.at(cause) : "Unknown", cause, addr);
+            return fmt::format("Trap with cause '{}' ({}) occurred  at address 0x{:016x}",
+                               cause < this->trap_str.size() ? this->trap_str.at(cause) : "Unknown", cause, addr);
+        });
     // reset trap state
     this->reg.PRIV = new_priv;
     this->reg.trap_state = 0;
@@ -478,7 +462,7 @@ template <typename BASE, features_e FEAT> uint64_t riscv_hart_m_p<BASE, FEAT>::l
     this->state.mstatus.MPIE = 1;
     // sets the pc to the value stored in the x epc register.
     this->reg.NEXT_PC = this->csr[mepc] & this->get_pc_mask();
-    this->disass_output("Executing xRET");
+    this->trap_log([]() { return std::string("Executing xRET"); });
     check_interrupt();
     this->reg.trap_state = this->reg.pending_trap;
     return this->reg.NEXT_PC;
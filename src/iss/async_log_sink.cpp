@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#include "async_log_sink.h"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <util/logging.h>
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
+
+namespace iss {
+namespace {
+#if defined(__linux__)
+ssize_t sink_write(void* cookie, char const* data, size_t length) { return static_cast<async_log_sink*>(cookie)->write(data, length); }
+
+FILE* open_stream(async_log_sink* sink) {
+    cookie_io_functions_t funcs{nullptr, &sink_write, nullptr, nullptr};
+    return fopencookie(sink, "w", funcs);
+}
+#elif defined(__APPLE__)
+int sink_write(void* cookie, char const* data, int length) { return static_cast<async_log_sink*>(cookie)->write(data, length); }
+
+FILE* open_stream(async_log_sink* sink) { return funopen(sink, nullptr, &sink_write, nullptr, nullptr); }
+#else
+FILE* open_stream(async_log_sink*) { return nullptr; }
+#endif
+
+bool ends_with(std::string const& str, std::string const& suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+} // namespace
+
+async_log_sink::config async_log_sink::parse_config(std::string const& options, std::string const& file_name) {
+    config res;
+    res.compress = ends_with(file_name, ".gz");
+    size_t start = 0;
+    while(start < options.size()) {
+        auto end = std::min(options.find(',', start), options.size());
+        auto opt = options.substr(start, end - start);
+        start = end + 1;
+        auto eq = opt.find('=');
+        auto key = opt.substr(0, eq);
+        auto val = eq == std::string::npos ? std::string{} : opt.substr(eq + 1);
+        if(key == "size" && val.size()) {
+            size_t unit = 1;
+            if(std::tolower(val.back()) == 'k')
+                unit = 1 << 10;
+            else if(std::tolower(val.back()) == 'm')
+                unit = 1 << 20;
+            try {
+                if(!std::isdigit(static_cast<unsigned char>(val.front())))
+                    throw std::invalid_argument(val);
+                res.size = std::max<size_t>(std::stoull(val) * unit, 4096);
+            } catch(std::logic_error const&) {
+                CPPLOG(WARN) << "async log: invalid size '" << val << "', using " << res.size << " bytes";
+            }
+        } else if(key == "policy" && (val == "block" || val == "drop"))
+            res.policy = val == "drop" ? full_policy::DROP : full_policy::BLOCK;
+        else if(opt.size())
+            CPPLOG(WARN) << "async log: ignoring unknown option '" << opt << "'";
+    }
+    return res;
+}
+
+async_log_sink::async_log_sink(std::string const& file_name, config const& cfg)
+: file_name(file_name)
+, cfg(cfg)
+, ring(size_t(1) << (64 - __builtin_clzll(cfg.size - 1)))
+, mask(ring.size() - 1) {
+    if(cfg.compress) {
+#ifdef WITH_ZLIB
+        gz_file = gzopen(file_name.c_str(), "wb");
+        if(!gz_file)
+            return;
+#else
+        CPPLOG(WARN) << "async log: compression is not available, writing " << file_name << " uncompressed";
+#endif
+    }
+    if(!gz_file && !(file = fopen(file_name.c_str(), "w")))
+        return;
+    stream = open_stream(this);
+    if(!stream)
+        return;
+    // the loggers flush after each message, so each call of write() is one message
+    setvbuf(stream, nullptr, _IOFBF, 1 << 16);
+    thread = std::thread([this]() { run(); });
+}
+
+async_log_sink::~async_log_sink() {
+    if(stream)
+        fclose(stream);
+    if(thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stop = true;
+        }
+        cv.notify_one();
+        thread.join();
+    }
+#ifdef WITH_ZLIB
+    if(gz_file)
+        gzclose(static_cast<gzFile>(gz_file));
+#endif
+    if(file)
+        fclose(file);
+    if(!stream)
+        return;
+    CPPLOG(INFO) << "async log " << file_name << ": " << messages << " messages (" << bytes << " bytes) written, " << blocked
+                 << " messages waited for the writer";
+    if(dropped)
+        CPPLOG(WARN) << "async log " << file_name << ": " << dropped << " messages (" << dropped_bytes
+                     << " bytes) dropped as the buffer was full";
+}
+
+size_t async_log_sink::write(char const* data, size_t length) {
+    auto h = head.load(std::memory_order_acquire);
+    if(h + length - tail.load(std::memory_order_acquire) > ring.size()) {
+        if(cfg.policy == full_policy::DROP) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            dropped_bytes.fetch_add(length, std::memory_order_relaxed);
+            // the data counts as consumed, otherwise the FILE reports an error to the logger
+            return length;
+        }
+        blocked.fetch_add(1, std::memory_order_relaxed);
+    }
+    messages.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(length, std::memory_order_relaxed);
+    auto* src = reinterpret_cast<uint8_t const*>(data);
+    for(auto remaining = length; remaining;) {
+        auto avail = ring.size() - (h - tail.load(std::memory_order_acquire));
+        if(!avail) {
+            std::this_thread::yield();
+            continue;
+        }
+        auto const offs = h & mask;
+        auto const n = std::min({remaining, avail, ring.size() - offs});
+        std::copy(src, src + n, ring.data() + offs);
+        src += n;
+        remaining -= n;
+        h += n;
+        head.store(h, std::memory_order_seq_cst);
+        if(writer_idle.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> lock(mtx);
+            cv.notify_one();
+        }
+    }
+    return length;
+}
+
+void async_log_sink::run() {
+    while(true) {
+        auto const t = tail.load(std::memory_order_relaxed);
+        auto const h = head.load(std::memory_order_acquire);
+        if(h == t) {
+            std::unique_lock<std::mutex> lock(mtx);
+            writer_idle.store(true, std::memory_order_seq_cst);
+            cv.wait(lock, [this, t]() { return stop || head.load(std::memory_order_seq_cst) != t; });
+            writer_idle.store(false, std::memory_order_relaxed);
+            if(head.load(std::memory_order_acquire) == t)
+                break;
+            continue;
+        }
+        auto const offs = t & mask;
+        auto const n = std::min<uint64_t>(h - t, ring.size() - offs);
+        output(ring.data() + offs, n);
+        tail.store(t + n, std::memory_order_release);
+    }
+    if(file)
+        fflush(file);
+}
+
+void async_log_sink::output(uint8_t const* data, size_t length) {
+#ifdef WITH_ZLIB
+    if(gz_file) {
+        gzwrite(static_cast<gzFile>(gz_file), data, length);
+        return;
+    }
+#endif
+    fwrite(data, 1, length, file);
+}
+} // namespace iss
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_ASYNC_LOG_SINK_H_
+#define _ISS_ASYNC_LOG_SINK_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace iss {
+/**
+ * an output file for the loggers which is written by a background thread. The FILE handle returned by get_stream() puts
+ * the data into a lock-free ring buffer, the writer thread takes it from there and writes it to the file, gzip
+ * compressed if requested. The FILE handle serializes its users, so there is only one producer at a time. If the
+ * ring buffer is full the producer either waits for the writer or drops the message, depending on the policy.
+ * The loggers need to be switched to another stream before the sink is destroyed.
+ */
+class async_log_sink {
+public:
+    enum class full_policy { BLOCK, DROP };
+
+    struct config {
+        //! the size of the ring buffer, rounded up to a power of 2
+        size_t size{1 << 22};
+        full_policy policy{full_policy::BLOCK};
+        bool compress{false};
+    };
+
+    //! parses 'size=<bytes>[k|m],policy=block|drop', the file is compressed if its name ends with '.gz'
+    static config parse_config(std::string const& options, std::string const& file_name);
+
+    async_log_sink(std::string const& file_name, config const& cfg);
+
+    async_log_sink(async_log_sink const&) = delete;
+
+    async_log_sink& operator=(async_log_sink const&) = delete;
+
+    ~async_log_sink();
+
+    //! the handle to be used as logger output, nullptr if the file could not be opened or the platform lacks support
+    FILE* get_stream() const { return stream; }
+
+    //! called by the FILE handle, returns the number of bytes consumed
+    size_t write(char const* data, size_t length);
+
+private:
+    void run();
+    void output(uint8_t const* data, size_t length);
+
+    std::string const file_name;
+    config const cfg;
+    std::vector<uint8_t> ring;
+    size_t const mask;
+    alignas(64) std::atomic<uint64_t> head{0};
+    alignas(64) std::atomic<uint64_t> tail{0};
+    alignas(64) std::atomic<bool> writer_idle{false};
+    std::atomic<bool> stop{false};
+    std::mutex mtx;
+    std::condition_variable cv;
+    FILE* file{nullptr};
+    void* gz_file{nullptr};
+    FILE* stream{nullptr};
+    // the FILE handle serializes the producers, the counters are atomic only to be visible to the destructor
+    std::atomic<uint64_t> messages{0}, bytes{0};
+    std::atomic<uint64_t> blocked{0}, dropped{0}, dropped_bytes{0};
+    std::thread thread;
+};
+} // namespace iss
+#endif /* _ISS_ASYNC_LOG_SINK_H_ */
@@ -34,6 +34,7 @@
 #define _ISS_ARCH_DEBUGGER_RISCV_TARGET_ADAPTER_H_
 
 #include "iss/arch_if.h"
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/arch/traits.h>
 #include <iss/debugger/target_adapter_base.h>
 #include <iss/iss.h>
@@ -59,7 +60,8 @@ template <typename ARCH> class riscv_target_adapter : public target_adapter_base
 public:
     riscv_target_adapter(server_if* srv, iss::arch_if* core)
     : target_adapter_base(srv)
-    , core(core) {}
+    , core(core)
+    , hart(dynamic_cast<iss::arch::riscv_hart_if*>(core)) {}
 
     /*============== Thread Control ===============================*/
 
@@ -137,6 +139,8 @@ protected:
     static inline constexpr addr_t map_addr(const addr_t& i) { return i; }
     std::string csr_xml;
     iss::arch_if* core;
+    //! the hart interface providing bulk accesses, nullptr if the core does not implement it
+    iss::arch::riscv_hart_if* hart;
     rp_thread_ref thread_idx;
 };
 
@@ -274,13 +278,17 @@ template <typename ARCH> status riscv_target_adapter<ARCH>::write_single_registe
 
 template <typename ARCH> status riscv_target_adapter<ARCH>::read_mem(uint64_t addr, std::vector<uint8_t>& data) {
     auto a = map_addr({iss::address_type::VIRTUAL, iss::access_type::DEBUG_READ, 0, addr});
-    auto f = [&]() -> status { return core->read(a, data.size(), data.data()); };
+    auto f = [&]() -> status {
+        return hart ? hart->read_debug_range(addr, data.size(), data.data()) : core->read(a, data.size(), data.data());
+    };
     return srv->execute_syncronized(f);
 }
 
 template <typename ARCH> status riscv_target_adapter<ARCH>::write_mem(uint64_t addr, const std::vector<uint8_t>& data) {
     auto a = map_addr({iss::address_type::VIRTUAL, iss::access_type::DEBUG_WRITE, 0, addr});
-    auto f = [&]() -> status { return core->write(a, data.size(), data.data()); };
+    auto f = [&]() -> status {
+        return hart ? hart->write_debug_range(addr, data.size(), data.data()) : core->write(a, data.size(), data.data());
+    };
     return srv->execute_syncronized(f);
 }
 
@@ -296,7 +304,35 @@ template <typename ARCH> status riscv_target_adapter<ARCH>::offsets_query(uint64
     return Ok;
 }
 
-template <typename ARCH> status riscv_target_adapter<ARCH>::crc_query(uint64_t addr, size_t len, uint32_t& val) { return NotSupported; }
+template <typename ARCH> status riscv_target_adapter<ARCH>::crc_query(uint64_t addr, size_t len, uint32_t& val) {
+    // the CRC-32 of the qCRC packet: polynomial 0x04c11db7, most significant bit first, no final inversion
+    static auto const table = []() {
+        std::array<uint32_t, 256> res;
+        for(uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i << 24;
+            for(auto bit = 0; bit < 8; ++bit)
+                c = c & 0x80000000 ? (c << 1) ^ 0x04c11db7 : c << 1;
+            res[i] = c;
+        }
+        return res;
+    }();
+    if(!hart)
+        return NotSupported;
+    auto f = [&]() -> status {
+        std::vector<uint8_t> data(std::min<size_t>(len, 1 << 16));
+        uint32_t crc = 0xffffffff;
+        for(size_t offs = 0; offs < len; offs += data.size()) {
+            auto chunk = std::min(data.size(), len - offs);
+            if(hart->read_debug_range(addr + offs, chunk, data.data()) != iss::Ok)
+                return Err;
+            for(size_t i = 0; i < chunk; ++i)
+                crc = (crc << 8) ^ table[((crc >> 24) ^ data[i]) & 0xff];
+        }
+        val = crc;
+        return Ok;
+    };
+    return srv->execute_syncronized(f);
+}
 
 template <typename ARCH> status riscv_target_adapter<ARCH>::raw_query(std::string in_buf, std::string& out_buf) { return NotSupported; }
 
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_MEM_ATOMIC_H_
+#define _ISS_MEM_ATOMIC_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace iss {
+namespace mem {
+/**
+ * an atomic read-modify-write a hart asks the memory holding the data to perform. It is passed along with a read (AMO)
+ * or write (SC, DISCARD) through the memory hierarchy, elements which cannot perform it handle the access as plain read
+ * or write and leave done unset
+ */
+struct atomic_op {
+    enum op_e { SWAP, ADD, XOR, AND, OR, MIN, MAX, MINU, MAXU, CAS, DISCARD } op{SWAP};
+    uint64_t operand{0};
+    //! CAS: the value expected in memory
+    uint64_t expected{0};
+    //! the value found in memory
+    uint64_t result{0};
+    bool done{false};
+};
+
+//! the atomic operation accompanying the memory access currently executed by this thread
+inline thread_local atomic_op* current_atomic{nullptr};
+
+/**
+ * hides the atomic operation of the current thread from the accesses a memory element performs on its own behalf,
+ * e.g. the page table walk of the MMU, so that only the data access itself carries it
+ */
+class atomic_op_suspender {
+public:
+    atomic_op_suspender()
+    : saved(current_atomic) {
+        current_atomic = nullptr;
+    }
+
+    ~atomic_op_suspender() { current_atomic = saved; }
+
+    atomic_op_suspender(atomic_op_suspender const&) = delete;
+
+    atomic_op_suspender& operator=(atomic_op_suspender const&) = delete;
+
+private:
+    atomic_op* const saved;
+};
+
+/**
+ * atomic access to plain host memory, a C++17 replacement of the subset of std::atomic_ref used here. It uses the
+ * atomic builtins of GCC and Clang, MSVC accesses the memory as std::atomic which has the same layout for the
+ * lock-free integer types
+ */
+template <typename T> class host_atomic_ref {
+public:
+    explicit host_atomic_ref(T& obj)
+    : ptr(&obj) {}
+#if defined(_MSC_VER)
+    static_assert(sizeof(std::atomic<T>) == sizeof(T) && std::atomic<T>::is_always_lock_free);
+    T load() const { return as_atomic().load(); }
+    T exchange(T val) const { return as_atomic().exchange(val); }
+    T fetch_add(T val) const { return as_atomic().fetch_add(val); }
+    T fetch_xor(T val) const { return as_atomic().fetch_xor(val); }
+    T fetch_and(T val) const { return as_atomic().fetch_and(val); }
+    T fetch_or(T val) const { return as_atomic().fetch_or(val); }
+    bool compare_exchange_strong(T& expected, T desired) const { return as_atomic().compare_exchange_strong(expected, desired); }
+    bool compare_exchange_weak(T& expected, T desired) const { return as_atomic().compare_exchange_weak(expected, desired); }
+
+private:
+    std::atomic<T>& as_atomic() const { return *reinterpret_cast<std::atomic<T>*>(ptr); }
+#else
+    T load() const { return __atomic_load_n(ptr, __ATOMIC_SEQ_CST); }
+    T exchange(T val) const { return __atomic_exchange_n(ptr, val, __ATOMIC_SEQ_CST); }
+    T fetch_add(T val) const { return __atomic_fetch_add(ptr, val, __ATOMIC_SEQ_CST); }
+    T fetch_xor(T val) const { return __atomic_fetch_xor(ptr, val, __ATOMIC_SEQ_CST); }
+    T fetch_and(T val) const { return __atomic_fetch_and(ptr, val, __ATOMIC_SEQ_CST); }
+    T fetch_or(T val) const { return __atomic_fetch_or(ptr, val, __ATOMIC_SEQ_CST); }
+    bool compare_exchange_strong(T& expected, T desired) const {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    }
+    bool compare_exchange_weak(T& expected, T desired) const {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    }
+
+private:
+#endif
+    T* const ptr;
+};
+
+//! performs op on naturally aligned host memory
+template <typename T> void perform_atomic(atomic_op& op, uint8_t* ptr) {
+    using S = std::make_signed_t<T>;
+    host_atomic_ref<T> mem(*reinterpret_cast<T*>(ptr));
+    auto const val = static_cast<T>(op.operand);
+    T old;
+    switch(op.op) {
+    case atomic_op::SWAP:
+        old = mem.exchange(val);
+        break;
+    case atomic_op::ADD:
+        old = mem.fetch_add(val);
+        break;
+    case atomic_op::XOR:
+        old = mem.fetch_xor(val);
+        break;
+    case atomic_op::AND:
+        old = mem.fetch_and(val);
+        break;
+    case atomic_op::OR:
+        old = mem.fetch_or(val);
+        break;
+    case atomic_op::CAS:
+        old = static_cast<T>(op.expected);
+        mem.compare_exchange_strong(old, val);
+        break;
+    default:
+        old = mem.load();
+        for(;;) {
+            T upd;
+            switch(op.op) {
+            case atomic_op::MIN:
+                upd = static_cast<S>(old) < static_cast<S>(val) ? old : val;
+                break;
+            case atomic_op::MAX:
+                upd = static_cast<S>(old) > static_cast<S>(val) ? old : val;
+                break;
+            case atomic_op::MINU:
+                upd = old < val ? old : val;
+                break;
+            default:
+                upd = old > val ? old : val;
+                break;
+            }
+            if(upd == old || mem.compare_exchange_weak(old, upd))
+                break;
+        }
+    }
+    op.result = old;
+    op.done = true;
+}
+
+/**
+ * the LR/SC reservations of all harts of the process with cache line granularity. LR snapshots the version of the
+ * line, stores to a line somebody holds a reservation for bump its version so that the SC of the other harts fails.
+ * Stores only read the table unless there is a reservation in the same slot, harts not using LR/SC do not contend here
+ */
+class reservation_table {
+public:
+    static constexpr unsigned line_bits = 6;
+
+    struct reservation {
+        uint64_t line{0};
+        uint32_t version{0};
+        //! the value loaded by LR, SC is performed as compare and swap against it
+        uint64_t value{0};
+        bool valid{false};
+    };
+
+    static reservation_table& instance() {
+        static reservation_table table;
+        return table;
+    }
+
+    void add_hart() { harts.fetch_add(1, std::memory_order_relaxed); }
+
+    void remove_hart() { harts.fetch_sub(1, std::memory_order_relaxed); }
+
+    //! needs to be called before LR loads the data
+    void reserve(reservation& r, uint64_t addr) {
+        release(r);
+        auto& s = get_slot(addr >> line_bits);
+        s.reserved.fetch_add(1);
+        r.line = addr >> line_bits;
+        r.version = s.version.load();
+        r.valid = true;
+    }
+
+    void release(reservation& r) {
+        if(r.valid)
+            get_slot(r.line).reserved.fetch_sub(1);
+        r.valid = false;
+    }
+
+    //! checks and releases the reservation
+    bool check(reservation& r, uint64_t addr) {
+        auto const ok = r.valid && r.line == addr >> line_bits && get_slot(r.line).version.load() == r.version;
+        release(r);
+        return ok;
+    }
+
+    //! needs to be called after a store to addr has been performed
+    void notify_store(uint64_t addr, unsigned length) {
+        if(harts.load(std::memory_order_relaxed) < 2)
+            return;
+        // pairs with the reservation taken before the load of LR
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for(auto line = addr >> line_bits; line <= (addr + length - 1) >> line_bits; ++line) {
+            auto& s = get_slot(line);
+            if(s.reserved.load(std::memory_order_relaxed))
+                s.version.fetch_add(1);
+        }
+    }
+
+private:
+    struct slot {
+        std::atomic<uint32_t> reserved{0};
+        std::atomic<uint32_t> version{0};
+    };
+
+    slot& get_slot(uint64_t line) { return slots[line & (slots.size() - 1)]; }
+
+    std::array<slot, 4096> slots;
+    std::atomic<unsigned> harts{0};
+};
+} // namespace mem
+} // namespace iss
+#endif /* _ISS_MEM_ATOMIC_H_ */
@@ -0,0 +1,431 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_MEM_CACHE_H
+#define _ISS_MEM_CACHE_H
+
+#include "memory_if.h"
+#include <iss/arch/hpm.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iss/vm_types.h>
+#include <util/ities.h>
+#include <util/logging.h>
+#include <vector>
+
+namespace iss {
+namespace mem {
+
+enum class replacement_policy { LRU, PLRU, RANDOM };
+
+enum class write_policy { WRITE_THROUGH, WRITE_BACK };
+
+struct cache_config {
+    //! capacity in bytes, 0 disables the cache
+    unsigned size{0};
+    //! line size in bytes, needs to be a power of 2
+    unsigned line_size{64};
+    //! associativity, needs to be a power of 2 not larger than 64
+    unsigned ways{4};
+    replacement_policy replacement{replacement_policy::PLRU};
+    write_policy policy{write_policy::WRITE_BACK};
+    //! allocate a line on a write miss, write-back caches always allocate
+    bool write_allocate{false};
+    //! only track tags and states, the data is always taken from the downstream memory
+    bool tag_only{true};
+    //! cycles added to an instruction for each cache hit
+    unsigned hit_latency{0};
+    //! cycles added to an instruction for each line fill
+    unsigned miss_latency{20};
+    //! cycles added to an instruction for each eviction of a dirty line
+    unsigned writeback_latency{20};
+    //! address range which bypasses the cache (e.g. peripherals)
+    uint64_t uncached_base{0};
+    uint64_t uncached_size{0};
+};
+
+/**
+ * tag and state store of one cache. The tags are kept in a flat array indexed by set * ways + way,
+ * each entry holds the line address together with the valid and dirty bit. Line data is only
+ * allocated if the cache is not in tag-only mode.
+ */
+class cache_array {
+public:
+    static constexpr uint64_t VALID = 0x1;
+    static constexpr uint64_t DIRTY = 0x2;
+    static constexpr unsigned STATE_BITS = 2;
+
+    struct statistics {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        uint64_t writebacks{0};
+    };
+
+    cache_array(cache_config const& cfg)
+    : cfg(cfg) {
+        if(!cfg.size)
+            return;
+        assert(cfg.line_size > 0 && (cfg.line_size & (cfg.line_size - 1)) == 0 && "line size needs to be a power of 2");
+        assert(cfg.ways > 0 && cfg.ways <= 64 && (cfg.ways & (cfg.ways - 1)) == 0 && "ways need to be a power of 2 <= 64");
+        num_sets = cfg.size / (cfg.line_size * cfg.ways);
+        assert(num_sets > 0 && (num_sets & (num_sets - 1)) == 0 && "number of sets needs to be a power of 2");
+        line_shift = util::ilog2(cfg.line_size);
+        way_bits = util::ilog2(cfg.ways);
+        tags.resize(num_sets * cfg.ways, 0);
+        switch(cfg.replacement) {
+        case replacement_policy::LRU:
+            ages.resize(num_sets * cfg.ways);
+            for(auto i = 0U; i < ages.size(); ++i)
+                ages[i] = i & (cfg.ways - 1);
+            break;
+        case replacement_policy::PLRU:
+            plru.resize(num_sets, 0);
+            break;
+        default:
+            break;
+        }
+        if(!cfg.tag_only)
+            data.resize(static_cast<size_t>(num_sets) * cfg.ways * cfg.line_size);
+    }
+
+    bool enabled() const { return num_sets != 0; }
+
+    uint64_t line_of(uint64_t addr) const { return addr >> line_shift; }
+
+    unsigned set_of(uint64_t line) const { return line & (num_sets - 1); }
+
+    //! returns the index of the entry holding line or -1 if it is not present
+    int lookup(uint64_t line) const {
+        auto const tag = line << STATE_BITS | VALID;
+        auto const* entry = &tags[set_of(line) << way_bits];
+        for(auto way = 0U; way < cfg.ways; ++way)
+            if((entry[way] & ~DIRTY) == tag)
+                return (set_of(line) << way_bits) + way;
+        return -1;
+    }
+
+    void touch(unsigned idx) {
+        switch(cfg.replacement) {
+        case replacement_policy::LRU: {
+            auto* age = &ages[idx & ~(cfg.ways - 1)];
+            auto const cur = ages[idx];
+            for(auto way = 0U; way < cfg.ways; ++way)
+                if(age[way] < cur)
+                    ++age[way];
+            ages[idx] = 0;
+        } break;
+        case replacement_policy::PLRU: {
+            // each node of the tree points to the half which should be replaced next
+            auto& bits = plru[idx >> way_bits];
+            auto const way = idx & (cfg.ways - 1);
+            for(unsigned level = 0, node = 1; level < way_bits; ++level) {
+                auto const dir = (way >> (way_bits - 1 - level)) & 1;
+                if(dir)
+                    bits &= ~(1ULL << node);
+                else
+                    bits |= 1ULL << node;
+                node = 2 * node + dir;
+            }
+        } break;
+        default:
+            break;
+        }
+    }
+
+    //! selects the entry to be replaced in the set of line, invalid entries are used first
+    unsigned victim(uint64_t line) {
+        auto const base = set_of(line) << way_bits;
+        for(auto way = 0U; way < cfg.ways; ++way)
+            if(!(tags[base + way] & VALID))
+                return base + way;
+        switch(cfg.replacement) {
+        case replacement_policy::LRU:
+            for(auto way = 0U; way < cfg.ways; ++way)
+                if(ages[base + way] == cfg.ways - 1)
+                    return base + way;
+            return base;
+        case replacement_policy::PLRU: {
+            auto const bits = plru[base >> way_bits];
+            unsigned node = 1;
+            for(auto level = 0U; level < way_bits; ++level)
+                node = 2 * node + ((bits >> node) & 1);
+            return base + (node - cfg.ways);
+        }
+        default:
+            // xorshift64
+            rnd_state ^= rnd_state << 13;
+            rnd_state ^= rnd_state >> 7;
+            rnd_state ^= rnd_state << 17;
+            return base + (rnd_state & (cfg.ways - 1));
+        }
+    }
+
+    uint64_t& tag(unsigned idx) { return tags[idx]; }
+
+    uint64_t line_addr(unsigned idx) const { return (tags[idx] >> STATE_BITS) << line_shift; }
+
+    uint8_t* line_data(unsigned idx) { return data.data() + static_cast<size_t>(idx) * cfg.line_size; }
+
+    cache_config const cfg;
+    statistics stats;
+
+private:
+    unsigned num_sets{0};
+    unsigned line_shift{0};
+    unsigned way_bits{0};
+    std::vector<uint64_t> tags;
+    std::vector<uint8_t> ages;
+    std::vector<uint64_t> plru;
+    std::vector<uint8_t> data;
+    uint64_t rnd_state{0x9e3779b97f4a7c15ULL};
+};
+
+/**
+ * timing model of a split instruction and data cache. It is meant to be placed in front of the
+ * last element of the memory hierarchy (e.g. using memory_hierarchy::insert_before_last) so that it sees
+ * physical addresses. The latencies of hits, misses and write-backs are added to the cycle count of
+ * the hart. In tag-only mode all accesses are forwarded to the downstream memory unchanged, otherwise
+ * hits are served from the line data held in the cache. The HTIF locations are never cached.
+ * Fetches see the dirty lines of a write-back data cache, so code copied to RAM can be executed without a
+ * fence.i. The model is private to one hart, a data mode cache is not coherent with the stores of other harts.
+ */
+class cache : public memory_elem {
+public:
+    using this_class = cache;
+
+    cache(cache_config const& icache_cfg, cache_config const& dcache_cfg, int64_t& cycle_offset, uint64_t const& tohost,
+          uint64_t const& fromhost, arch::hpm_counters* hpm = nullptr)
+    : icache(icache_cfg)
+    , dcache(dcache_cfg)
+    , cycle_offset(cycle_offset)
+    , tohost(tohost)
+    , fromhost(fromhost)
+    , hpm(hpm) {}
+
+    ~cache() {
+        report("icache", icache);
+        report("dcache", dcache);
+    }
+
+    memory_if get_mem_if() override {
+        return memory_if{.rd_mem{util::delegate<rd_mem_func_sig>::from<this_class, &this_class::read_mem>(this)},
+                         .wr_mem{util::delegate<wr_mem_func_sig>::from<this_class, &this_class::write_mem>(this)}};
+    }
+
+    void set_next(memory_if mem) override { down_stream_mem = mem; }
+
+    cache_array::statistics const& get_icache_stats() const { return icache.stats; }
+
+    cache_array::statistics const& get_dcache_stats() const { return dcache.stats; }
+
+private:
+    bool is_uncached(cache_array const& c, uint64_t addr) const {
+        return addr - c.cfg.uncached_base < c.cfg.uncached_size || addr == tohost || addr == fromhost;
+    }
+
+    iss::status read_mem(addr_t const& addr, unsigned length, uint8_t* data) {
+        auto& c = is_fetch(addr.access) ? icache : dcache;
+        if(unlikely(is_debug(addr.access)))
+            return debug_read(addr, length, data);
+        if(!c.enabled() || is_uncached(c, addr.val))
+            return &c == &icache ? read_snooped(addr, length, data) : down_stream_mem.rd_mem(addr, length, data);
+        auto const line_size = c.cfg.line_size;
+        auto offset = 0U;
+        for(auto line = c.line_of(addr.val); offset < length; ++line) {
+            auto const start = std::max<uint64_t>(line * line_size, addr.val);
+            auto const len = std::min<uint64_t>((line + 1) * line_size - start, length - offset);
+            auto idx = c.lookup(line);
+            if(idx < 0) {
+                idx = fill(c, addr, line);
+                if(idx < 0)
+                    return iss::Err;
+            } else {
+                c.stats.hits++;
+                cycle_offset += c.cfg.hit_latency;
+            }
+            c.touch(idx);
+            if(!c.cfg.tag_only)
+                std::memcpy(data + offset, c.line_data(idx) + (start & (line_size - 1)), len);
+            offset += len;
+        }
+        if(!c.cfg.tag_only)
+            return iss::Ok;
+        return &c == &icache ? read_snooped(addr, length, data) : down_stream_mem.rd_mem(addr, length, data);
+    }
+
+    iss::status write_mem(addr_t const& addr, unsigned length, uint8_t const* data) {
+        if(unlikely(is_debug(addr.access)))
+            return debug_write(addr, length, data);
+        auto& c = dcache;
+        if(!c.enabled() || is_uncached(c, addr.val))
+            return down_stream_mem.wr_mem(addr, length, data);
+        auto const write_back = c.cfg.policy == write_policy::WRITE_BACK;
+        auto const line_size = c.cfg.line_size;
+        auto offset = 0U;
+        for(auto line = c.line_of(addr.val); offset < length; ++line) {
+            auto const start = std::max<uint64_t>(line * line_size, addr.val);
+            auto const len = std::min<uint64_t>((line + 1) * line_size - start, length - offset);
+            auto idx = c.lookup(line);
+            if(idx >= 0) {
+                c.stats.hits++;
+                cycle_offset += c.cfg.hit_latency;
+            } else if(write_back || c.cfg.write_allocate) {
+                idx = fill(c, addr, line);
+                if(idx < 0)
+                    return iss::Err;
+            } else {
+                c.stats.misses++;
+                if(hpm)
+                    hpm->count(arch::HPM_DCACHE_MISS);
+            }
+            if(idx >= 0) {
+                c.touch(idx);
+                if(write_back)
+                    c.tag(idx) |= cache_array::DIRTY;
+                if(!c.cfg.tag_only)
+                    std::memcpy(c.line_data(idx) + (start & (line_size - 1)), data + offset, len);
+            }
+            update_icache(start, len, data + offset);
+            offset += len;
+        }
+        // in tag-only mode the cache does not hold data so a write-back cache also needs to update the memory
+        return write_back && !c.cfg.tag_only ? iss::Ok : down_stream_mem.wr_mem(addr, length, data);
+    }
+
+    //! allocates an entry for line evicting a dirty line if needed, returns -1 if the line could not be read
+    int fill(cache_array& c, addr_t const& addr, uint64_t line) {
+        c.stats.misses++;
+        cycle_offset += c.cfg.miss_latency;
+        if(hpm)
+            hpm->count(&c == &icache ? arch::HPM_ICACHE_MISS : arch::HPM_DCACHE_MISS);
+        auto const idx = c.victim(line);
+        auto& tag = c.tag(idx);
+        if((tag & (cache_array::VALID | cache_array::DIRTY)) == (cache_array::VALID | cache_array::DIRTY)) {
+            c.stats.writebacks++;
+            cycle_offset += c.cfg.writeback_latency;
+            if(!c.cfg.tag_only &&
+               down_stream_mem.wr_mem({addr.type, access_type::WRITE, addr.space, c.line_addr(idx)}, c.cfg.line_size, c.line_data(idx)) !=
+                   iss::Ok)
+                return -1;
+        }
+        tag = 0;
+        auto const access = is_fetch(addr.access) ? addr.access : access_type::READ;
+        if(!c.cfg.tag_only) {
+            addr_t const line_addr{addr.type, access, addr.space, line * c.cfg.line_size};
+            if(down_stream_mem.rd_mem(line_addr, c.cfg.line_size, c.line_data(idx)) != iss::Ok)
+                return -1;
+            if(&c == &icache)
+                snoop_dcache(line_addr.val, c.cfg.line_size, c.line_data(idx));
+        }
+        tag = line << cache_array::STATE_BITS | cache_array::VALID;
+        return idx;
+    }
+
+    //! keeps the line data of the instruction cache coherent with stores
+    void update_icache(uint64_t addr, unsigned length, uint8_t const* data) {
+        if(icache.cfg.tag_only || !icache.enabled())
+            return;
+        auto idx = icache.lookup(icache.line_of(addr));
+        if(idx >= 0)
+            std::memcpy(icache.line_data(idx) + (addr & (icache.cfg.line_size - 1)), data, length);
+    }
+
+    //! reads from the downstream memory and overlays the dirty lines of the data cache
+    iss::status read_snooped(addr_t const& addr, unsigned length, uint8_t* data) {
+        auto res = down_stream_mem.rd_mem(addr, length, data);
+        if(res == iss::Ok)
+            snoop_dcache(addr.val, length, data);
+        return res;
+    }
+
+    //! copies the data of dirty data cache lines overlapping [addr, addr+length) into data
+    void snoop_dcache(uint64_t addr, unsigned length, uint8_t* data) {
+        if(dcache.cfg.tag_only || !dcache.enabled() || dcache.cfg.policy != write_policy::WRITE_BACK)
+            return;
+        auto const line_size = dcache.cfg.line_size;
+        auto offset = 0U;
+        for(auto line = dcache.line_of(addr); offset < length; ++line) {
+            auto const start = std::max<uint64_t>(line * line_size, addr);
+            auto const len = std::min<uint64_t>((line + 1) * line_size - start, length - offset);
+            auto idx = dcache.lookup(line);
+            if(idx >= 0 && (dcache.tag(idx) & cache_array::DIRTY))
+                std::memcpy(data + offset, dcache.line_data(idx) + (start & (line_size - 1)), len);
+            offset += len;
+        }
+    }
+
+    //! debug accesses neither change the cache state nor account cycles but need to see dirty data
+    iss::status debug_read(addr_t const& addr, unsigned length, uint8_t* data) { return read_snooped(addr, length, data); }
+
+    iss::status debug_write(addr_t const& addr, unsigned length, uint8_t const* data) {
+        auto res = down_stream_mem.wr_mem(addr, length, data);
+        if(res != iss::Ok)
+            return res;
+        for(auto* c : {&icache, &dcache}) {
+            if(c->cfg.tag_only || !c->enabled())
+                continue;
+            auto const line_size = c->cfg.line_size;
+            auto offset = 0U;
+            for(auto line = c->line_of(addr.val); offset < length; ++line) {
+                auto const start = std::max<uint64_t>(line * line_size, addr.val);
+                auto const len = std::min<uint64_t>((line + 1) * line_size - start, length - offset);
+                auto idx = c->lookup(line);
+                if(idx >= 0)
+                    std::memcpy(c->line_data(idx) + (start & (line_size - 1)), data + offset, len);
+                offset += len;
+            }
+        }
+        return res;
+    }
+
+    static void report(char const* name, cache_array const& c) {
+        if(!c.enabled())
+            return;
+        auto const accesses = c.stats.hits + c.stats.misses;
+        CPPLOG(INFO) << name << ": " << accesses << " accesses, " << c.stats.hits << " hits, " << c.stats.misses << " misses ("
+                     << (accesses ? 100.0 * c.stats.misses / accesses : 0.0) << "%), " << c.stats.writebacks << " write-backs";
+    }
+
+    cache_array icache;
+    cache_array dcache;
+    int64_t& cycle_offset;
+    uint64_t const& tohost;
+    uint64_t const& fromhost;
+    arch::hpm_counters* hpm;
+    memory_if down_stream_mem;
+};
+} // namespace mem
+} // namespace iss
+#endif // _ISS_MEM_CACHE_H
@@ -0,0 +1,290 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+
+#ifndef _ISS_MEM_CLINT_H
+#define _ISS_MEM_CLINT_H
+
+#include "iss/arch/riscv_hart_common.h"
+#include "iss/vm_plugin.h"
+#include "iss/vm_types.h"
+#include "memory_if.h"
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <util/logging.h>
+
+namespace iss {
+namespace mem {
+struct clint_config {
+    uint64_t base{0x2000000};
+    //! number of cycles per mtime tick
+    uint64_t divider{100000000 / 32768 - 1};
+};
+
+/**
+ * CLINT-style timer for standalone simulation providing msip and mtimecmp for each hart and a common mtime. The
+ * CLINT is shared by all harts, each hart accesses it through its own clint::port inserted into its memory
+ * hierarchy. The registers of hart n are located at MSIP + 4 * n and MTIMECMP + 8 * n so that harts can send
+ * each other software interrupts. mtime is derived from the cycle count of the accessing hart, the harts run at
+ * most one quantum apart.
+ * The timer is checked after each instruction by the instrumentation hook returned from port::get_timer_check(),
+ * which needs to be registered with the vm of the hart, as well as on every access passing a port and on WFI.
+ * If a single hart waits for an interrupt and the timer is the only possible wake-up source the cycle count is
+ * advanced straight to the timer deadline. Idle loops are advanced as well but not beyond the timer deadline.
+ */
+class clint {
+public:
+    static constexpr uint64_t MSIP = 0x0;
+    static constexpr uint64_t MTIMECMP = 0x4000;
+    static constexpr uint64_t MTIME = 0xbff8;
+    static constexpr unsigned MSIP_IRQ = 3;
+    static constexpr unsigned MTIP_IRQ = 7;
+
+    class port;
+
+    clint(clint_config const& cfg, unsigned num_harts)
+    : cfg(cfg)
+    , regs(std::min(num_harts, 4095U)) {}
+
+private:
+    // the registers of a hart, they may be written by other harts running in a different thread
+    struct hart_regs {
+        std::atomic<uint64_t> mtimecmp{std::numeric_limits<uint64_t>::max()};
+        std::atomic<uint32_t> msip{0};
+        //! set on changes of the registers or of mtime, the hart re-evaluates its interrupts before the next instruction
+        std::atomic<bool> changed{false};
+    };
+
+    clint_config const cfg;
+    std::vector<hart_regs> regs;
+    std::atomic<int64_t> mtime_offset{0};
+};
+
+//! the connection of a hart to the CLINT
+class clint::port : public memory_elem {
+public:
+    using this_class = port;
+
+    port(std::shared_ptr<clint> owner, arch::riscv_hart_if& hart, unsigned id)
+    : owner(std::move(owner))
+    , regs(this->owner->regs.at(id))
+    , hart(hart)
+    , cfg(this->owner->cfg)
+    , cycle(hart.get_cycle_counter())
+    , cycle_offset(hart.get_cycle_offset())
+    , timer_check(*this) {
+        hart.set_wait_handler([this](uint64_t mie, uint64_t max_cycles) { return wait_for_interrupt(mie, max_cycles); });
+        hart.set_time_source([this]() { return get_mtime(); });
+    }
+
+    ~port() {
+        if(idle_cycles)
+            CPPLOG(INFO) << "clint: skipped " << idle_cycles << " idle cycles in " << idle_count << " waits";
+    }
+
+    memory_if get_mem_if() override {
+        return memory_if{.rd_mem{util::delegate<rd_mem_func_sig>::from<this_class, &this_class::read_mem>(this)},
+                         .wr_mem{util::delegate<wr_mem_func_sig>::from<this_class, &this_class::write_mem>(this)}};
+    }
+
+    void set_next(memory_if mem) override { down_stream_mem = mem; }
+
+    std::tuple<uint64_t, uint64_t> get_range() override { return {cfg.base, cfg.base + 0xbfff}; }
+
+    uint64_t get_idle_cycles() const { return idle_cycles; }
+
+    //! the plugin raising the timer interrupt once the deadline has passed, also in code not accessing the CLINT
+    vm_plugin& get_timer_check() { return timer_check; }
+
+private:
+    struct timer_check_plugin : public vm_plugin {
+        explicit timer_check_plugin(port& owner)
+        : owner(owner) {}
+
+        bool registration(const char* const version, vm_if& arch) override { return true; }
+
+        sync_type get_sync() override { return POST_SYNC; }
+
+        void callback(instr_info_t) override { owner.check(); }
+
+        port& owner;
+    };
+
+    uint64_t total_cycles() const { return cycle + cycle_offset; }
+
+    uint64_t get_mtime() const {
+        // the cycle counts of the harts differ slightly, so mtime set by one hart may be in the past of another one
+        auto const time = static_cast<int64_t>(total_cycles() / cfg.divider) + owner->mtime_offset.load(std::memory_order_relaxed);
+        return time > 0 ? static_cast<uint64_t>(time) : 0;
+    }
+
+    void check() {
+        if(unlikely(regs.changed.load(std::memory_order_acquire)))
+            update();
+        check_timer();
+    }
+
+    void check_timer() {
+        if(unlikely(!mtip && total_cycles() >= deadline)) {
+            mtip = true;
+            hart.set_local_irq(MTIP_IRQ, true);
+        }
+    }
+
+    //! applies changes of the registers, only called from the thread of the hart
+    void update() {
+        regs.changed.store(false, std::memory_order_relaxed);
+        auto const sip = regs.msip.load(std::memory_order_relaxed) != 0;
+        if(sip != msip) {
+            msip = sip;
+            hart.set_local_irq(MSIP_IRQ, msip);
+        }
+        update_deadline();
+    }
+
+    void update_deadline() {
+        auto const mtimecmp = regs.mtimecmp.load(std::memory_order_relaxed);
+        auto const mtime_offset = owner->mtime_offset.load(std::memory_order_relaxed);
+        // mtime_offset may be negative if mtime was set back
+        auto const ticks = mtimecmp - static_cast<uint64_t>(mtime_offset);
+        if(mtime_offset >= 0 && mtimecmp < static_cast<uint64_t>(mtime_offset))
+            deadline = 0;
+        else if((mtime_offset < 0 && ticks < mtimecmp) || ticks > std::numeric_limits<uint64_t>::max() / cfg.divider)
+            deadline = std::numeric_limits<uint64_t>::max();
+        else
+            deadline = ticks * cfg.divider;
+        if(mtip && total_cycles() < deadline) {
+            mtip = false;
+            hart.set_local_irq(MTIP_IRQ, false);
+        }
+        check_timer();
+    }
+
+    uint64_t wait_for_interrupt(uint64_t mie, uint64_t max_cycles) {
+        check();
+        // skipping the idle time of one of several harts would let its mtime run ahead of the others
+        if(mtip || msip || owner->regs.size() > 1)
+            return 0;
+        auto cycles = max_cycles;
+        if((mie & (1ULL << MTIP_IRQ)) && deadline != std::numeric_limits<uint64_t>::max()) {
+            auto const now = total_cycles();
+            cycles = deadline > now ? std::min(deadline - now, max_cycles) : 0;
+        }
+        // no wake-up source and no limit given
+        if(cycles == std::numeric_limits<uint64_t>::max())
+            return 0;
+        if(cycles) {
+            cycle_offset += cycles;
+            idle_cycles += cycles;
+            idle_count++;
+        }
+        check_timer();
+        return cycles;
+    }
+
+    //! returns the hart whose register is accessed at offs or nullptr if the access does not hit a register
+    hart_regs* get_regs(uint64_t offs, unsigned length, uint64_t reg_base, unsigned reg_size) {
+        auto const idx = (offs - reg_base) / reg_size;
+        if(offs < reg_base || idx >= owner->regs.size() || (offs - reg_base) % reg_size + length > reg_size)
+            return nullptr;
+        return &owner->regs[idx];
+    }
+
+    iss::status read_mem(addr_t const& addr, unsigned length, uint8_t* data) {
+        check();
+        if(addr.val >= cfg.base && addr.val + length <= cfg.base + 0xc000) {
+            uint64_t reg_val{0};
+            auto const offs = addr.val - cfg.base;
+            if(offs >= MTIME && offs + length <= MTIME + 8)
+                reg_val = get_mtime() >> (8 * (offs - MTIME));
+            else if(auto* r = offs >= MTIMECMP ? get_regs(offs, length, MTIMECMP, 8) : nullptr)
+                reg_val = r->mtimecmp.load(std::memory_order_relaxed) >> (8 * ((offs - MTIMECMP) & 7));
+            else if(auto* r = offs < MTIMECMP ? get_regs(offs, length, MSIP, 4) : nullptr)
+                reg_val = r->msip.load(std::memory_order_relaxed) >> (8 * ((offs - MSIP) & 3));
+            std::memcpy(data, &reg_val, std::min<unsigned>(length, sizeof(reg_val)));
+            return iss::Ok;
+        }
+        return down_stream_mem.rd_mem(addr, length, data);
+    }
+
+    iss::status write_mem(addr_t const& addr, unsigned length, uint8_t const* data) {
+        check();
+        if(addr.val >= cfg.base && addr.val + length <= cfg.base + 0xc000) {
+            uint64_t val{0};
+            std::memcpy(&val, data, std::min<unsigned>(length, sizeof(val)));
+            auto const offs = addr.val - cfg.base;
+            auto merge = [length, &val](uint64_t reg, unsigned shift) {
+                auto const mask = (length >= 8 ? std::numeric_limits<uint64_t>::max() : (1ULL << (8 * length)) - 1) << shift;
+                return (reg & ~mask) | ((val << shift) & mask);
+            };
+            if(offs >= MTIME && offs + length <= MTIME + 8) {
+                auto new_time = merge(get_mtime(), 8 * (offs - MTIME));
+                owner->mtime_offset.store(static_cast<int64_t>(new_time - total_cycles() / cfg.divider), std::memory_order_relaxed);
+                for(auto& r : owner->regs)
+                    r.changed.store(true, std::memory_order_release);
+            } else if(auto* r = offs >= MTIMECMP ? get_regs(offs, length, MTIMECMP, 8) : nullptr) {
+                r->mtimecmp.store(merge(r->mtimecmp.load(std::memory_order_relaxed), 8 * ((offs - MTIMECMP) & 7)),
+                                  std::memory_order_relaxed);
+                r->changed.store(true, std::memory_order_release);
+            } else if(auto* r = offs < MTIMECMP ? get_regs(offs, length, MSIP, 4) : nullptr) {
+                r->msip.store(merge(r->msip.load(std::memory_order_relaxed), 8 * ((offs - MSIP) & 3)) & 0x1, std::memory_order_relaxed);
+                r->changed.store(true, std::memory_order_release);
+            }
+            // changes of the own registers take effect immediately
+            check();
+            return iss::Ok;
+        }
+        return down_stream_mem.wr_mem(addr, length, data);
+    }
+
+    std::shared_ptr<clint> owner;
+    hart_regs& regs;
+    arch::riscv_hart_if& hart;
+    clint_config const& cfg;
+    uint64_t const& cycle;
+    int64_t& cycle_offset;
+    memory_if down_stream_mem;
+    uint64_t deadline{std::numeric_limits<uint64_t>::max()};
+    bool mtip{false};
+    bool msip{false};
+    uint64_t idle_cycles{0};
+    uint64_t idle_count{0};
+    timer_check_plugin timer_check;
+};
+} // namespace mem
+} // namespace iss
+#endif // _ISS_MEM_CLINT_H
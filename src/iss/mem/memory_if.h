@@ -73,6 +73,8 @@ struct memory_hierarchy {
     void insert_before_last(std::unique_ptr<memory_elem>&&);
     void insert_after_first(std::unique_ptr<memory_elem>&&);
     void replace_last(std::unique_ptr<memory_elem>&&);
+    //! the leaf of the hierarchy, usually the main memory
+    memory_elem& last() const { return *hierarchy.back(); }
 
 protected:
     void update_chain();
@@ -38,14 +38,71 @@
 #include "iss/arch/riscv_hart_common.h"
 #include "iss/arch/traits.h"
 #include "iss/vm_types.h"
+#include "atomic.h"
 #include "memory_if.h"
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <util/logging.h>
-#include <util/sparse_array.h>
 
 namespace iss {
 namespace mem {
+/**
+ * the pages of a memory. They are allocated on the first write and published atomically, so harts running in other
+ * threads look them up without taking a lock
+ */
+template <uint64_t SIZE, unsigned PAGE_BITS = 24> class paged_memory {
+public:
+    static constexpr uint64_t page_size = 1ULL << PAGE_BITS;
+    static constexpr uint64_t page_addr_mask = page_size - 1;
+    using page_type = std::array<uint8_t, page_size>;
+
+    paged_memory() = default;
+
+    ~paged_memory() {
+        for(auto& p : pages)
+            delete p.load(std::memory_order_relaxed);
+    }
+
+    paged_memory(paged_memory const&) = delete;
+
+    paged_memory& operator=(paged_memory const&) = delete;
+
+    //! returns the page holding addr or nullptr if it has not been written yet
+    page_type* find(uint64_t addr) const {
+        assert((addr >> PAGE_BITS) < pages.size());
+        return pages[addr >> PAGE_BITS].load(std::memory_order_acquire);
+    }
+
+    //! returns the page holding addr, allocating it if needed
+    page_type& get(uint64_t addr) {
+        if(auto* p = find(addr))
+            return *p;
+        std::lock_guard<std::mutex> lock(mtx);
+        auto& entry = pages[addr >> PAGE_BITS];
+        auto* p = entry.load(std::memory_order_relaxed);
+        if(!p) {
+            p = new page_type();
+            entry.store(p, std::memory_order_release);
+        }
+        return *p;
+    }
+
+private:
+    std::array<std::atomic<page_type*>, (SIZE - 1) / page_size + 1> pages{};
+    std::mutex mtx;
+};
+
+/**
+ * the main memory of a hart with the HTIF tohost/fromhost handling. Several harts may share the content of one memory
+ * by share_storage(), each of them keeps its own memory element so that the HTIF requests are executed by the hart
+ * issuing them
+ */
 template <typename PLAT> struct neumann_memory_with_htif : public memory_elem {
     using this_class = neumann_memory_with_htif<PLAT>;
     using reg_t = typename PLAT::reg_t;
@@ -64,26 +121,44 @@ template <typename PLAT> struct neumann_memory_with_htif : public memory_elem {
         // intentionally left empty, leaf element
     }
 
+    //! makes this memory use the content of other, used by platforms instantiating several harts
+    void share_storage(memory_elem& other) {
+        auto* o = dynamic_cast<this_class*>(&other);
+        assert(o && "the memories to share need to be of the same type");
+        store = o->store;
+    }
+
 private:
+    // Memory footprint is still small as the pages are only allocated when written
+    using mem_type = paged_memory<(arch::traits<PLAT>::max_mem_size < (1ull << 36) ? arch::traits<PLAT>::max_mem_size : (1ull << 36))>;
+
+    //! the content of the memories and the lock serializing the HTIF requests of the harts sharing them
+    struct storage {
+        std::array<mem_type, arch::traits<PLAT>::mem_sizes.size()> memories{};
+        std::mutex htif_mtx;
+    };
+
+    mem_type& get_mem(iss::addr_t const& addr) {
+        return store->memories[addr.space == iss::arch::traits<PLAT>::IMEM ? iss::arch::traits<PLAT>::MEM : addr.space];
+    }
+
     iss::status read_mem(const iss::addr_t& addr, unsigned length, uint8_t* data) {
         assert((addr.type == iss::address_type::PHYSICAL || is_debug(addr.access)) &&
                "Only physical addresses are expected in memory_with_htif");
-        mem_type& mem = addr.space == iss::arch::traits<PLAT>::IMEM ? memories[iss::arch::traits<PLAT>::MEM] : memories[addr.space];
-        if(mem.is_allocated(addr.val)) {
-            const auto& p = mem(addr.val / mem.page_size);
-            auto offs = addr.val & mem.page_addr_mask;
-            if((offs + length) > mem.page_size) {
-                auto first_part = mem.page_size - offs;
-                std::copy(p.data() + offs, p.data() + offs + first_part, data);
-                const auto& p2 = mem((addr.val / mem.page_size) + 1);
-                std::copy(p2.data(), p2.data() + length - first_part, data + first_part);
+        mem_type& mem = get_mem(addr);
+        if(unlikely(current_atomic != nullptr) && (length == 4 || length == 8))
+            return atomic_access(mem, addr.val, length, data);
+        // copy page by page so that bulk accesses of arbitrary size work
+        for(uint64_t offs = 0, len = 0; offs < length; offs += len) {
+            auto const page_offs = (addr.val + offs) & mem.page_addr_mask;
+            len = std::min<uint64_t>(mem.page_size - page_offs, length - offs);
+            if(auto const* p = mem.find(addr.val + offs)) {
+                std::copy(p->data() + page_offs, p->data() + page_offs + len, data + offs);
             } else {
-                std::copy(p.data() + offs, p.data() + offs + length, data);
+                // no allocated page so return randomized data
+                for(size_t i = 0; i < len; i++)
+                    data[offs + i] = std::rand() % 256;
             }
-        } else {
-            // no allocated page so return randomized data
-            for(size_t i = 0; i < length; i++)
-                data[i] = std::rand() % 256;
         }
         return iss::Ok;
     }
@@ -91,31 +166,48 @@ private:
     iss::status write_mem(const iss::addr_t& addr, unsigned length, uint8_t const* data) {
         assert((addr.type == iss::address_type::PHYSICAL || is_debug(addr.access)) &&
                "Only physical addresses are expected in memory_with_htif");
-        mem_type& mem = addr.space == iss::arch::traits<PLAT>::IMEM ? memories[iss::arch::traits<PLAT>::MEM] : memories[addr.space];
-        auto& p = mem(addr.val / mem.page_size);
-        auto offs = addr.val & mem.page_addr_mask;
-        if((offs + length) > mem.page_size) {
-            auto first_part = mem.page_size - offs;
-            std::copy(data, data + first_part, p.data() + offs);
-            auto& p2 = mem((addr.val / mem.page_size) + 1);
-            std::copy(data + first_part, data + length, p2.data());
-        } else {
-            std::copy(data, data + length, p.data() + offs);
+        mem_type& mem = get_mem(addr);
+        if(unlikely(current_atomic != nullptr) && (length == 4 || length == 8))
+            return atomic_access(mem, addr.val, length, nullptr);
+        for(uint64_t offs = 0, len = 0; offs < length; offs += len) {
+            auto const page_offs = (addr.val + offs) & mem.page_addr_mask;
+            len = std::min<uint64_t>(mem.page_size - page_offs, length - offs);
+            auto& p = mem.get(addr.val + offs);
+            std::copy(data + offs, data + offs + len, p.data() + page_offs);
         }
-        if(addr.val == hart_if.tohost) {
+        if(unlikely(addr.val == hart_if.tohost)) {
+            std::lock_guard<std::mutex> lock(store->htif_mtx);
             return hart_if.exec_htif(data, length);
         }
         return iss::Ok;
     }
 
-protected:
-    // Currently no type erasure for the sparse_array is available, so all memories
-    // have the largest possible size. Memory footprint should still be small as it
-    // a sparse array
-    using mem_type = util::sparse_array < uint8_t,
-          arch::traits<PLAT>::max_mem_size<1ull << 36 ? arch::traits<PLAT>::max_mem_size : (1ull << 36)>;
-    std::array<mem_type, arch::traits<PLAT>::mem_sizes.size()> memories{};
+    //! performs the pending atomic operation on the host memory, the old value is returned in data if given
+    iss::status atomic_access(mem_type& mem, uint64_t addr, unsigned length, uint8_t* data) {
+        auto& op = *current_atomic;
+        if(op.op == atomic_op::DISCARD) {
+            op.done = true;
+            return iss::Ok;
+        }
+        auto* ptr = mem.get(addr).data() + (addr & mem.page_addr_mask);
+        if(length == 8)
+            perform_atomic<uint64_t>(op, ptr);
+        else
+            perform_atomic<uint32_t>(op, ptr);
+        if(data)
+            std::memcpy(data, &op.result, length);
+        // an AMO or successful SC updating tohost issues an HTIF request like a plain store does
+        if(unlikely(addr == hart_if.tohost) && (op.op != atomic_op::CAS || ((op.result ^ op.expected) << (64 - 8 * length)) == 0)) {
+            std::array<uint8_t, 8> val;
+            std::memcpy(val.data(), ptr, length);
+            std::lock_guard<std::mutex> lock(store->htif_mtx);
+            return hart_if.exec_htif(val.data(), length);
+        }
+        return iss::Ok;
+    }
+
     arch::priv_if<reg_t> hart_if;
+    std::shared_ptr<storage> store{std::make_shared<storage>()};
 };
 } // namespace mem
 } // namespace iss
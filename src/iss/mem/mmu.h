@@ -39,6 +39,7 @@
 #include "iss/arch/traits.h"
 #include "iss/arch_if.h"
 #include "iss/vm_types.h"
+#include "atomic.h"
 #include "memory_if.h"
 #include "util/ities.h"
 #include <cstdint>
@@ -114,38 +115,48 @@ private:
 
     iss::status read_mem(const addr_t& addr, unsigned length, uint8_t* data) {
         assert((addr.type == iss::address_type::VIRTUAL || is_debug(addr.access)) && "Only virtual addresses are expected in mmu");
-        if(unlikely((addr.val & ~PGMASK) != ((addr.val + length - 1) & ~PGMASK) &&
-                    needs_translation(addr))) { // we may cross a page boundary
+        if(!needs_translation(addr))
+            return down_stream_mem.rd_mem({iss::address_type::PHYSICAL, addr.access, addr.space, addr.val}, length, data);
+        // the memory performs an AMO already during its read, so the page needs to be writable and faults are store faults
+        auto const access = unlikely(current_atomic != nullptr) ? iss::access_type::WRITE : addr.access;
+        uint64_t paddr;
+        if(unlikely((addr.val & ~PGMASK) != ((addr.val + length - 1) & ~PGMASK))) { // we cross a page boundary
             auto split_addr = (addr.val + length) & ~PGMASK;
             auto len1 = split_addr - addr.val;
-            auto res = down_stream_mem.rd_mem({iss::address_type::PHYSICAL, addr.access, addr.space, virt2phys(addr.access, addr.val)},
-                                              len1, data);
-            if(res == iss::Ok)
-                res = down_stream_mem.rd_mem({iss::address_type::PHYSICAL, addr.access, addr.space, virt2phys(addr.access, addr.val)},
-                                             length - len1, data + len1);
-            return res;
+            if(virt2phys(access, addr.val, paddr) != iss::Ok)
+                return iss::Err;
+            auto res = down_stream_mem.rd_mem({iss::address_type::PHYSICAL, addr.access, addr.space, paddr}, len1, data);
+            if(res != iss::Ok)
+                return res;
+            if(virt2phys(access, split_addr, paddr) != iss::Ok)
+                return iss::Err;
+            return down_stream_mem.rd_mem({iss::address_type::PHYSICAL, addr.access, addr.space, paddr}, length - len1, data + len1);
         }
-        return down_stream_mem.rd_mem(
-            {iss::address_type::PHYSICAL, addr.access, addr.space, needs_translation(addr) ? virt2phys(addr.access, addr.val) : addr.val},
-            length, data);
+        if(virt2phys(access, addr.val, paddr) != iss::Ok)
+            return iss::Err;
+        return down_stream_mem.rd_mem({iss::address_type::PHYSICAL, addr.access, addr.space, paddr}, length, data);
     }
 
     iss::status write_mem(const addr_t& addr, unsigned length, uint8_t const* data) {
         assert((addr.type == iss::address_type::VIRTUAL || is_debug(addr.access)) && "Only virtual addresses are expected in mmu");
-        if(unlikely((addr.val & ~PGMASK) != ((addr.val + length - 1) & ~PGMASK) &&
-                    needs_translation(addr))) { // we may cross a page boundary
+        if(!needs_translation(addr))
+            return down_stream_mem.wr_mem({iss::address_type::PHYSICAL, addr.access, addr.space, addr.val}, length, data);
+        uint64_t paddr;
+        if(unlikely((addr.val & ~PGMASK) != ((addr.val + length - 1) & ~PGMASK))) { // we cross a page boundary
             auto split_addr = (addr.val + length) & ~PGMASK;
             auto len1 = split_addr - addr.val;
-            auto res = down_stream_mem.wr_mem({iss::address_type::PHYSICAL, addr.access, addr.space, virt2phys(addr.access, addr.val)},
-                                              len1, data);
-            if(res == iss::Ok)
-                res = down_stream_mem.wr_mem({iss::address_type::PHYSICAL, addr.access, addr.space, virt2phys(addr.access, split_addr)},
-                                             length - len1, data + len1);
-            return res;
+            if(virt2phys(addr.access, addr.val, paddr) != iss::Ok)
+                return iss::Err;
+            auto res = down_stream_mem.wr_mem({iss::address_type::PHYSICAL, addr.access, addr.space, paddr}, len1, data);
+            if(res != iss::Ok)
+                return res;
+            if(virt2phys(addr.access, split_addr, paddr) != iss::Ok)
+                return iss::Err;
+            return down_stream_mem.wr_mem({iss::address_type::PHYSICAL, addr.access, addr.space, paddr}, length - len1, data + len1);
         }
-        return down_stream_mem.wr_mem(
-            {iss::address_type::PHYSICAL, addr.access, addr.space, needs_translation(addr) ? virt2phys(addr.access, addr.val) : addr.val},
-            length, data);
+        if(virt2phys(addr.access, addr.val, paddr) != iss::Ok)
+            return iss::Err;
+        return down_stream_mem.wr_mem({iss::address_type::PHYSICAL, addr.access, addr.space, paddr}, length, data);
     }
 
     iss::status read_plain(unsigned addr, reg_t& val) {
@@ -180,7 +191,7 @@ private:
         return iss::Ok;
     }
 
-    uint64_t virt2phys(iss::access_type access, uint64_t addr);
+    iss::status virt2phys(iss::access_type access, uint64_t addr, uint64_t& paddr);
 
     template <typename T = reg_t, std::enable_if_t<std::is_same_v<T, uint32_t>, bool> = true> inline void update_vm_info() {
         switch(bit_sub<31, 1>(satp)) {
@@ -215,17 +226,34 @@ private:
             abort();
         }
     }
-    void throw_page_fault(iss::access_type type, uint64_t bad_addr) {
-        switch(type) {
+    // faults are reported to the hart via raise_trap, debug accesses fail silently
+    iss::status raise_fault(iss::access_type access, unsigned fetch_cause, unsigned load_cause, unsigned store_cause, uint64_t bad_addr) {
+        if(is_debug(access))
+            return iss::Err;
+        switch(access & iss::access_type::FUNC) {
         case access_type::FETCH:
-            throw arch::trap_instruction_page_fault(bad_addr);
+            hart_if.raise_trap(0, fetch_cause, bad_addr);
+            break;
         case access_type::READ:
-            throw arch::trap_load_page_fault(bad_addr);
+            hart_if.raise_trap(0, load_cause, bad_addr);
+            break;
         case access_type::WRITE:
-            throw arch::trap_store_page_fault(bad_addr);
+            hart_if.raise_trap(0, store_cause, bad_addr);
+            break;
         default:
             abort();
         }
+        return iss::Err;
+    }
+
+    iss::status page_fault(iss::access_type access, uint64_t bad_addr) {
+        return raise_fault(access, arch::traits<PLAT>::RV_CAUSE_FETCH_PAGE_FAULT, arch::traits<PLAT>::RV_CAUSE_LOAD_PAGE_FAULT,
+                           arch::traits<PLAT>::RV_CAUSE_STORE_PAGE_FAULT, bad_addr);
+    }
+
+    iss::status access_fault(iss::access_type access, uint64_t bad_addr) {
+        return raise_fault(access, arch::traits<PLAT>::RV_CAUSE_FETCH_ACCESS, arch::traits<PLAT>::RV_CAUSE_LOAD_ACCESS,
+                           arch::traits<PLAT>::RV_CAUSE_STORE_ACCESS, bad_addr);
     }
 
 protected:
@@ -236,12 +264,15 @@ protected:
     memory_if down_stream_mem;
 };
 
-template <typename PLAT> uint64_t mmu<PLAT>::virt2phys(iss::access_type access, uint64_t addr) {
+template <typename PLAT> iss::status mmu<PLAT>::virt2phys(iss::access_type access, uint64_t addr, uint64_t& paddr) {
     const auto type = access & iss::access_type::FUNC;
     reg_t pte{0};
     if(auto it = tlb.find(addr >> PGSHIFT); it != tlb.end()) {
         pte = it->second;
     } else {
+        // the page table accesses must not perform the atomic operation of an AMO or SC
+        atomic_op_suspender no_atomic;
+        hart_if.hpm.count(arch::HPM_TLB_MISS);
         update_vm_info();
         reg_t base = vm_setting.ptbase;
         const int va_bits = vm_setting.idxbits * vm_setting.levels + PGSHIFT;
@@ -249,7 +280,7 @@ template <typename PLAT> uint64_t mmu<PLAT>::virt2phys(iss::access_type access,
         const reg_t masked_msbs = (addr >> (va_bits - 1)) & mask;
         if(masked_msbs != 0 && masked_msbs != mask) {
             CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": invalid unused address bits";
-            throw_page_fault(type, addr);
+            return page_fault(access, addr);
         }
         for(int i = vm_setting.levels - 1; i >= 0; i--) {
             const int ptshift = i * vm_setting.idxbits;
@@ -259,33 +290,24 @@ template <typename PLAT> uint64_t mmu<PLAT>::virt2phys(iss::access_type access,
                 vm_setting.ptesize, (uint8_t*)&pte);
             if(res != iss::status::Ok) {
                 CPPLOG(DEBUG) << "Access fault when trying to read next pte";
-                switch(type) {
-                case iss::access_type::READ:
-                    throw arch::trap_load_access_fault(addr);
-                case iss::access_type::WRITE:
-                    throw arch::trap_store_access_fault(addr);
-                case iss::access_type::FETCH:
-                    throw arch::trap_instruction_access_fault(addr);
-                default:
-                    abort();
-                };
+                return access_fault(access, addr);
             }
             if(bit_sub<63, 1>(static_cast<uint64_t>(pte))) {
                 CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": set 'N' bit without Svnapot extension present";
-                throw_page_fault(type, addr);
+                return page_fault(access, addr);
             }
             if(bit_sub<61, 2>(static_cast<uint64_t>(pte))) {
                 CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": set 'PBMT' bit(s) without Svpbmt extension present";
-                throw_page_fault(type, addr);
+                return page_fault(access, addr);
             }
             if(bit_sub<54, 7>(static_cast<uint64_t>(pte))) {
                 CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": set 'reserved' bits";
-                throw_page_fault(type, addr);
+                return page_fault(access, addr);
             }
 
             if(!(pte & PTE_V) || (!(pte & PTE_R) && (pte & PTE_W))) {
                 CPPLOG(INFO) << "Page fault for address 0x" << std::hex << addr << ": invalid page, PTE=0x" << std::hex << pte;
-                throw_page_fault(type, addr);
+                return page_fault(access, addr);
             }
             const reg_t ppn = pte >> PTE_PPN_SHIFT;
             if(!(pte & PTE_R || pte & PTE_X)) {
@@ -294,7 +316,7 @@ template <typename PLAT> uint64_t mmu<PLAT>::virt2phys(iss::access_type access,
             }
             if((ppn & ((reg_t(1) << ptshift) - 1)) != 0) {
                 CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": page misalignment";
-                throw_page_fault(type, addr);
+                return page_fault(access, addr);
             }
             if(!(pte & PTE_A) || (type == iss::access_type::WRITE && !(pte & PTE_D))) {
                 // non-Svade
@@ -308,7 +330,7 @@ template <typename PLAT> uint64_t mmu<PLAT>::virt2phys(iss::access_type access,
 
                 // Svade behavior
                 CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": unset A or D bit";
-                throw_page_fault(type, addr);
+                return page_fault(access, addr);
             }
             const reg_t vpn = addr >> PGSHIFT;
             const reg_t value = (ppn | (vpn & ((reg_t(1) << ptshift) - 1))) << PGSHIFT;
@@ -322,17 +344,18 @@ template <typename PLAT> uint64_t mmu<PLAT>::virt2phys(iss::access_type access,
     const bool sum = hart_if.state.mstatus.SUM;
     if((pte & PTE_U) ? s_mode && (type == iss::access_type::FETCH || !sum) : !s_mode) {
         CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": SUM bit";
-        throw_page_fault(type, addr);
+        return page_fault(access, addr);
     }
     const bool mxr = hart_if.state.mstatus.MXR;
     if(type == iss::access_type::FETCH   ? !(pte & PTE_X)
        : type == iss::access_type::WRITE ? !(pte & PTE_W)
                                          : !((pte & PTE_R) || (mxr && (pte & PTE_X)))) {
         CPPLOG(DEBUG) << "Page fault for address 0x" << std::hex << addr << ": Invalid request";
-        throw_page_fault(type, addr);
+        return page_fault(access, addr);
     }
 
-    return (pte & (~PGMASK)) | (addr & PGMASK);
+    paddr = (pte & (~PGMASK)) | (addr & PGMASK);
+    return iss::Ok;
 }
 } // namespace mem
 } // namespace iss
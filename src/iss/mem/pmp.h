@@ -38,6 +38,7 @@
 #include "iss/arch/riscv_hart_common.h"
 #include "iss/arch/traits.h"
 #include "iss/vm_types.h"
+#include "atomic.h"
 #include "memory_if.h"
 #include <util/logging.h>
 
@@ -85,23 +86,32 @@ private:
 
     iss::status read_mem(const addr_t& addr, unsigned length, uint8_t* data) {
         assert((addr.type == iss::address_type::PHYSICAL || is_debug(addr.access)) && "Only physical addresses are expected in pmp");
-        if(likely(addr.space == arch::traits<PLAT>::MEM || std::numeric_limits<decltype(phys_addr_t::space)>::max()) &&
-           !pmp_check(addr.access, addr.val, length) && !is_debug(addr.access)) {
-            if(is_debug(addr.access))
-                throw trap_access(0, addr.val);
-            hart_if.raise_trap(/*trap_id*/ 0, /*cause*/ (addr.access == access_type::FETCH) ? 1 : 5, /*fault_data*/ addr.val);
-            return iss::Err;
+        if(likely(addr.space == arch::traits<PLAT>::MEM || addr.space == arch::traits<PLAT>::IMEM) && !is_debug(addr.access)) {
+            hart_if.hpm.count(arch::HPM_PMP_CHECK);
+            if(!pmp_check(addr.access, addr.val, length)) {
+                hart_if.hpm.count(arch::HPM_PMP_FAULT);
+                hart_if.raise_trap(/*trap_id*/ 0, /*cause*/ is_fetch(addr.access) ? 1 : current_atomic ? 7 : 5, /*fault_data*/ addr.val);
+                return iss::Err;
+            }
+            // the memory performs an AMO already during its read, so the write needs to be permitted as well
+            if(unlikely(current_atomic != nullptr) && !pmp_check(access_type::WRITE, addr.val, length)) {
+                hart_if.hpm.count(arch::HPM_PMP_FAULT);
+                hart_if.raise_trap(/*trap_id*/ 0, /*cause*/ 7, /*fault_data*/ addr.val);
+                return iss::Err;
+            }
         }
         return down_stream_mem.rd_mem(addr, length, data);
     }
 
     iss::status write_mem(const addr_t& addr, unsigned length, uint8_t const* data) {
         assert((addr.type == iss::address_type::PHYSICAL || is_debug(addr.access)) && "Only physical addresses are expected in pmp");
-        if(likely(addr.space == arch::traits<PLAT>::MEM) && !pmp_check(addr.access, addr.val, length) && !is_debug(addr.access)) {
-            if(is_debug(addr.access))
-                throw trap_access(0, addr.val);
-            hart_if.raise_trap(/*trap_id*/ 0, /*cause*/ 7, /*fault_data*/ addr.val);
-            return iss::Err;
+        if(likely(addr.space == arch::traits<PLAT>::MEM) && !is_debug(addr.access)) {
+            hart_if.hpm.count(arch::HPM_PMP_CHECK);
+            if(!pmp_check(addr.access, addr.val, length)) {
+                hart_if.hpm.count(arch::HPM_PMP_FAULT);
+                hart_if.raise_trap(/*trap_id*/ 0, /*cause*/ 7, /*fault_data*/ addr.val);
+                return iss::Err;
+            }
         }
         return down_stream_mem.wr_mem(addr, length, data);
     }
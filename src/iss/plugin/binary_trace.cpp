@@ -0,0 +1,306 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#include "binary_trace.h"
+#include "binary_trace_format.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <iss/arch/riscv_hart_common.h>
+#include <iss/arch_if.h>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <util/logging.h>
+
+namespace iss {
+namespace plugin {
+namespace {
+constexpr size_t chunk_size = 1 << 18;
+//! number of filled buffers the writer may lag behind before the simulation waits for it
+constexpr size_t max_pending = 64;
+} // namespace
+
+//! writes the filled buffers to the file and hands them back for reuse
+class binary_trace::writer {
+public:
+    writer(FILE* file)
+    : file(file)
+    , thread([this]() { run(); }) {}
+
+    ~writer() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stop = true;
+        }
+        cv.notify_all();
+        thread.join();
+        fclose(file);
+    }
+
+    //! queues buf for writing and returns an empty buffer of at least min_size bytes
+    std::vector<uint8_t> exchange(std::vector<uint8_t>&& buf, size_t min_size) {
+        std::unique_lock<std::mutex> lock(mtx);
+        done_cv.wait(lock, [this]() { return queue.size() < max_pending; });
+        if(buf.size())
+            queue.push_back(std::move(buf));
+        cv.notify_one();
+        std::vector<uint8_t> res;
+        if(free_list.size()) {
+            res = std::move(free_list.back());
+            free_list.pop_back();
+        }
+        lock.unlock();
+        res.resize(std::max(chunk_size, min_size));
+        return res;
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while(true) {
+            cv.wait(lock, [this]() { return stop || !queue.empty(); });
+            if(queue.empty())
+                return;
+            auto buf = std::move(queue.front());
+            queue.pop_front();
+            lock.unlock();
+            fwrite(buf.data(), 1, buf.size(), file);
+            lock.lock();
+            buf.clear();
+            free_list.push_back(std::move(buf));
+            done_cv.notify_all();
+        }
+    }
+
+    FILE* file;
+    std::mutex mtx;
+    std::condition_variable cv, done_cv;
+    std::deque<std::vector<uint8_t>> queue;
+    std::vector<std::vector<uint8_t>> free_list;
+    bool stop{false};
+    std::thread thread;
+};
+
+//! passes the memory writes of the hart to the trace, it is inserted right after the hart in the memory hierarchy
+struct binary_trace::write_observer : public mem::memory_elem {
+    using this_class = write_observer;
+
+    write_observer(binary_trace* owner)
+    : owner(owner) {}
+
+    mem::memory_if get_mem_if() override {
+        return mem::memory_if{.rd_mem{util::delegate<mem::rd_mem_func_sig>::from<this_class, &this_class::read_mem>(this)},
+                              .wr_mem{util::delegate<mem::wr_mem_func_sig>::from<this_class, &this_class::write_mem>(this)}};
+    }
+
+    void set_next(mem::memory_if mem) override { down_stream_mem = mem; }
+
+    iss::status read_mem(const addr_t& addr, unsigned length, uint8_t* data) { return down_stream_mem.rd_mem(addr, length, data); }
+
+    iss::status write_mem(const addr_t& addr, unsigned length, uint8_t const* data) {
+        auto res = down_stream_mem.wr_mem(addr, length, data);
+        // address space 0 is the main memory of all cores
+        if(res == iss::Ok && owner && addr.space == 0 && !is_debug(addr.access))
+            owner->record_write(addr.val, length, data);
+        return res;
+    }
+
+    binary_trace* owner;
+    mem::memory_if down_stream_mem;
+};
+
+binary_trace::binary_trace(std::string const& arg) {
+    auto pos = arg.find(',');
+    file_name = arg.substr(0, pos);
+    while(pos != std::string::npos) {
+        auto next = arg.find(',', pos + 1);
+        auto opt = arg.substr(pos + 1, next == std::string::npos ? std::string::npos : next - pos - 1);
+        if(opt == "regs")
+            with_regs = true;
+        else if(opt == "mem")
+            with_mem = true;
+        else
+            CPPLOG(WARN) << "binary trace: ignoring unknown option '" << opt << "'";
+        pos = next;
+    }
+    if(file_name.empty())
+        file_name = "trace.rvbt";
+    cached_pc.fill(std::numeric_limits<uint64_t>::max());
+}
+
+binary_trace::~binary_trace() {
+    if(observer)
+        observer->owner = nullptr;
+    if(!out)
+        return;
+    auto* p = reserve(1 + rvbt::max_varint_size);
+    p[0] = rvbt::TAG_END;
+    pos += 1 + rvbt::put_varint(p + 1, instructions);
+    bytes += pos;
+    buffer.resize(pos);
+    out->exchange(std::move(buffer), 0);
+    out.reset();
+    CPPLOG(INFO) << "binary trace: " << instructions << " instructions in " << bytes << " bytes ("
+                 << (instructions ? static_cast<double>(bytes) / instructions : 0.0) << " bytes per instruction) written to "
+                 << file_name;
+}
+
+bool binary_trace::registration(const char* const version, vm_if& vm) {
+    instr_if = vm.get_arch()->get_instrumentation_if();
+    if(!instr_if)
+        return false;
+    hart = dynamic_cast<iss::arch::riscv_hart_if*>(vm.get_arch());
+    xlen = instr_if->get_reg_size(0);
+    if(with_regs)
+        reg_base = vm.get_arch()->get_regs_base_ptr();
+    if(with_mem) {
+        if(hart) {
+            auto elem = std::make_unique<write_observer>(this);
+            observer = elem.get();
+            hart->get_memory_hierarchy().insert_after_first(std::move(elem));
+        } else {
+            CPPLOG(WARN) << "binary trace: memory writes cannot be recorded for core " << instr_if->core_type_name();
+            with_mem = false;
+        }
+    }
+    auto* file = fopen(file_name.c_str(), "wb");
+    if(!file) {
+        CPPLOG(ERR) << "binary trace: could not open " << file_name;
+        return false;
+    }
+    out = std::make_unique<writer>(file);
+    buffer = out->exchange({}, 0);
+    std::memcpy(buffer.data(), rvbt::magic, sizeof(rvbt::magic));
+    buffer[4] = rvbt::version;
+    buffer[5] = static_cast<uint8_t>(xlen);
+    buffer[6] = (with_regs ? rvbt::FLAG_REGS : 0) | (with_mem ? rvbt::FLAG_MEM : 0);
+    buffer[7] = 0;
+    pos = rvbt::header_size;
+    return true;
+}
+
+void binary_trace::record_write(uint64_t addr, unsigned length, uint8_t const* data) {
+    // the length is stored in a byte, so larger writes are split
+    for(unsigned offs = 0; offs < length; offs += 128) {
+        auto const len = std::min(length - offs, 128U);
+        auto const size = mem_writes.size();
+        mem_writes.resize(size + rvbt::max_varint_size + 1 + len);
+        auto* p = mem_writes.data() + size;
+        auto n = rvbt::put_varint(p, addr + offs);
+        p[n++] = static_cast<uint8_t>(len);
+        std::memcpy(p + n, data + offs, len);
+        mem_writes.resize(size + n + len);
+        mem_write_cnt++;
+    }
+}
+
+void binary_trace::callback(instr_info_t instr_info) {
+    if(!out)
+        return;
+    auto const pc = instr_if->get_pc();
+    auto const instr = static_cast<uint32_t>(instr_if->get_instr_word());
+    auto const trap = instr_if->get_pending_traps();
+    // tag, PC delta, instruction word, trap state, privilege level, the registers and the memory writes
+    auto const max_size = 1 + 2 * rvbt::max_varint_size + 4 + 1 + 1 + 31 * (1 + rvbt::max_varint_size) + rvbt::max_varint_size +
+                          mem_writes.size();
+    auto* const start = reserve(max_size);
+    auto* p = start + 1;
+    uint8_t tag = 0;
+    if(pc != expected_pc) {
+        tag |= rvbt::TAG_PC;
+        p += rvbt::put_svarint(p, static_cast<int64_t>(pc - expected_pc));
+    }
+    auto const idx = (pc >> 1) & (word_cache_size - 1);
+    if(cached_pc[idx] != pc || cached_word[idx] != instr) {
+        cached_pc[idx] = pc;
+        cached_word[idx] = instr;
+        tag |= rvbt::TAG_INSTR;
+        std::memcpy(p, &instr, rvbt::instr_length(instr));
+        p += rvbt::instr_length(instr);
+    }
+    if(trap) {
+        tag |= rvbt::TAG_TRAP;
+        p += rvbt::put_varint(p, trap);
+    }
+    if(hart) {
+        auto const curr_priv = hart->get_privilege_level();
+        if(curr_priv != priv) {
+            priv = curr_priv;
+            tag |= rvbt::TAG_PRIV;
+            *p++ = static_cast<uint8_t>(priv);
+        }
+    }
+    if(reg_base) {
+        auto* cnt = p++;
+        *cnt = 0;
+        for(auto i = 1U; i < 32; ++i) {
+            uint64_t val = 0;
+            std::memcpy(&val, reg_base + i * xlen / 8, xlen / 8);
+            if(val != regs[i]) {
+                regs[i] = val;
+                *p++ = static_cast<uint8_t>(i);
+                p += rvbt::put_varint(p, val);
+                ++*cnt;
+            }
+        }
+        if(*cnt)
+            tag |= rvbt::TAG_REGS;
+        else
+            p--;
+    }
+    if(mem_write_cnt) {
+        tag |= rvbt::TAG_MEM;
+        p += rvbt::put_varint(p, mem_write_cnt);
+        std::memcpy(p, mem_writes.data(), mem_writes.size());
+        p += mem_writes.size();
+        mem_writes.clear();
+        mem_write_cnt = 0;
+    }
+    *start = tag;
+    pos = p - buffer.data();
+    expected_pc = pc + rvbt::instr_length(instr);
+    instructions++;
+}
+
+void binary_trace::flush(size_t min_size) {
+    bytes += pos;
+    buffer.resize(pos);
+    buffer = out->exchange(std::move(buffer), min_size);
+    pos = 0;
+}
+} // namespace plugin
+} // namespace iss
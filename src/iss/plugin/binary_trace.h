@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_PLUGIN_BINARY_TRACE_H_
+#define _ISS_PLUGIN_BINARY_TRACE_H_
+
+#include "iss/instrumentation_if.h"
+#include "iss/vm_plugin.h"
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace iss {
+namespace arch {
+struct riscv_hart_if;
+}
+namespace plugin {
+/**
+ * writes a compact binary trace of the retired instructions, see binary_trace_format.h for the format. The records
+ * are collected in large buffers which are written to the file by a dedicated thread. The argument is the name of
+ * the trace file optionally followed by ',regs' and/or ',mem' to record the written integer registers and the
+ * memory writes. The trace can be converted to text using rvbt-decode.
+ */
+class binary_trace : public vm_plugin {
+public:
+    binary_trace() = delete;
+
+    binary_trace(const binary_trace&) = delete;
+
+    binary_trace(const binary_trace&&) = delete;
+
+    binary_trace(std::string const& arg);
+
+    virtual ~binary_trace();
+
+    binary_trace& operator=(const binary_trace&) = delete;
+
+    binary_trace& operator=(const binary_trace&&) = delete;
+
+    bool registration(const char* const version, vm_if& arch) override;
+
+    sync_type get_sync() override { return POST_SYNC; };
+
+    void callback(instr_info_t instr_info) override;
+
+    //! called by the memory hierarchy for each write of the current instruction
+    void record_write(uint64_t addr, unsigned length, uint8_t const* data);
+
+private:
+    class writer;
+    struct write_observer;
+
+    uint8_t* reserve(size_t n) {
+        if(pos + n > buffer.size())
+            flush(n);
+        return buffer.data() + pos;
+    }
+    void flush(size_t min_size);
+
+    std::string file_name;
+    bool with_regs{false};
+    bool with_mem{false};
+    iss::instrumentation_if* instr_if{nullptr};
+    iss::arch::riscv_hart_if* hart{nullptr};
+    uint8_t const* reg_base{nullptr};
+    unsigned xlen{32};
+    std::unique_ptr<writer> out;
+    write_observer* observer{nullptr};
+    std::vector<uint8_t> buffer;
+    size_t pos{0};
+    uint64_t expected_pc{0};
+    unsigned priv{3};
+    uint64_t instructions{0};
+    uint64_t bytes{0};
+    //! direct mapped cache of the instruction words already written, indexed by the PC
+    static constexpr unsigned word_cache_size = 4096;
+    std::array<uint64_t, word_cache_size> cached_pc;
+    std::array<uint32_t, word_cache_size> cached_word;
+    std::array<uint64_t, 32> regs{};
+    //! memory writes of the current instruction as address, length and data
+    std::vector<uint8_t> mem_writes;
+    unsigned mem_write_cnt{0};
+};
+} // namespace plugin
+} // namespace iss
+
+#endif /* _ISS_PLUGIN_BINARY_TRACE_H_ */
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _ISS_PLUGIN_BINARY_TRACE_FORMAT_H_
+#define _ISS_PLUGIN_BINARY_TRACE_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace iss {
+namespace plugin {
+/**
+ * layout of the binary instruction trace written by the binary_trace plugin and read by rvbt-decode. All values are
+ * little endian, variable length integers use 7 bits per byte with the MSB set on all but the last byte (LEB128).
+ *
+ * The file starts with a header: the magic "RVBT", the version, XLEN, the flags and a reserved byte. It is followed
+ * by one record per retired instruction starting with a tag byte. The bits of the tag select the fields following
+ * it in this order:
+ * - TAG_PC: the PC is not the PC of the previous instruction plus its length, the signed difference follows
+ * - TAG_INSTR: the instruction word follows as 2 or 4 bytes, depending on its two LSBs. It is only written when the
+ *   PC is seen first or the code at the PC changed
+ * - TAG_TRAP: the instruction raised a trap, the trap state of the hart follows
+ * - TAG_PRIV: the instruction changed the privilege level, the new level follows as one byte
+ * - TAG_REGS: the number of written integer registers follows as one byte, then per register its number (one
+ *   byte) and the new value
+ * - TAG_MEM: the number of memory writes follows, then per write the address, the length (one byte) and the data
+ * A tag with TAG_END set ends the trace, the number of recorded instructions follows.
+ */
+namespace rvbt {
+constexpr char magic[4] = {'R', 'V', 'B', 'T'};
+constexpr uint8_t version = 1;
+constexpr size_t header_size = 8;
+
+enum flags : uint8_t { FLAG_REGS = 1, FLAG_MEM = 2 };
+
+enum tag : uint8_t { TAG_PC = 1, TAG_INSTR = 2, TAG_TRAP = 4, TAG_PRIV = 8, TAG_REGS = 16, TAG_MEM = 32, TAG_END = 128 };
+
+//! max. number of bytes of an encoded 64bit value
+constexpr size_t max_varint_size = 10;
+
+inline size_t put_varint(uint8_t* p, uint64_t val) {
+    size_t n = 0;
+    while(val >= 0x80) {
+        p[n++] = static_cast<uint8_t>(val) | 0x80;
+        val >>= 7;
+    }
+    p[n++] = static_cast<uint8_t>(val);
+    return n;
+}
+
+inline size_t put_svarint(uint8_t* p, int64_t val) {
+    return put_varint(p, (static_cast<uint64_t>(val) << 1) ^ static_cast<uint64_t>(val >> 63));
+}
+
+//! decodes a value, returns the number of bytes used or 0 if the input ends before the value
+inline size_t get_varint(uint8_t const* p, size_t avail, uint64_t& val) {
+    val = 0;
+    for(size_t n = 0; n < avail && n < max_varint_size; ++n) {
+        val |= static_cast<uint64_t>(p[n] & 0x7f) << (7 * n);
+        if(!(p[n] & 0x80))
+            return n + 1;
+    }
+    return 0;
+}
+
+inline size_t get_svarint(uint8_t const* p, size_t avail, int64_t& val) {
+    uint64_t raw;
+    auto n = get_varint(p, avail, raw);
+    val = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+    return n;
+}
+
+inline unsigned instr_length(uint32_t instr) { return (instr & 3) == 3 ? 4 : 2; }
+} // namespace rvbt
+} // namespace plugin
+} // namespace iss
+#endif /* _ISS_PLUGIN_BINARY_TRACE_FORMAT_H_ */
@@ -0,0 +1,461 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#include "htif_syscalls.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iss/vm_types.h>
+#include <limits>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace iss {
+namespace {
+// syscall numbers of the RISC-V Linux ABI as used by riscv-pk and libgloss
+enum htif_syscall_nums : uint64_t {
+    SYS_getcwd = 17,
+    SYS_unlinkat = 35,
+    SYS_faccessat = 48,
+    SYS_openat = 56,
+    SYS_close = 57,
+    SYS_lseek = 62,
+    SYS_read = 63,
+    SYS_write = 64,
+    SYS_pread = 67,
+    SYS_pwrite = 68,
+    SYS_fstatat = 79,
+    SYS_fstat = 80,
+    SYS_exit = 93,
+    SYS_exit_group = 94,
+    SYS_clock_gettime = 113,
+    SYS_gettimeofday = 169,
+    SYS_brk = 214,
+    SYS_open = 1024,
+    SYS_unlink = 1026,
+    SYS_access = 1033,
+    SYS_stat = 1038,
+    SYS_lstat = 1039,
+    SYS_time = 1062
+};
+
+constexpr int64_t GUEST_AT_FDCWD = -100;
+constexpr uint64_t GUEST_AT_SYMLINK_NOFOLLOW = 0x100;
+constexpr uint64_t GUEST_CLOCK_MONOTONIC = 1;
+//! max. number of bytes copied from or to the guest memory at once
+constexpr size_t max_chunk = 1 << 20;
+//! max. size of a path read from the guest memory
+constexpr size_t max_path = 4096;
+//! console output kept in EXIT mode before it is written anyway
+constexpr size_t max_console_buffer = 1 << 20;
+
+inline int64_t neg_errno() { return -static_cast<int64_t>(errno); }
+
+#ifndef _WIN32
+//! the guest uses the open flags of the generic Linux ABI, they are translated to the ones of the host
+int to_host_flags(uint64_t flags) {
+    int res = flags & 3;
+    if(flags & 0100)
+        res |= O_CREAT;
+    if(flags & 0200)
+        res |= O_EXCL;
+    if(flags & 01000)
+        res |= O_TRUNC;
+    if(flags & 02000)
+        res |= O_APPEND;
+    return res;
+}
+
+template <typename T> void put(std::array<uint8_t, 128>& buf, unsigned offs, T val) { std::memcpy(buf.data() + offs, &val, sizeof(T)); }
+
+//! struct kernel_stat of the RISC-V Linux ABI, the layout is identical for RV32 and RV64
+std::array<uint8_t, 128> to_guest_stat(struct stat const& st) {
+    std::array<uint8_t, 128> res{};
+    put<uint64_t>(res, 0, st.st_dev);
+    put<uint64_t>(res, 8, st.st_ino);
+    put<uint32_t>(res, 16, st.st_mode);
+    put<uint32_t>(res, 20, st.st_nlink);
+    put<uint32_t>(res, 24, st.st_uid);
+    put<uint32_t>(res, 28, st.st_gid);
+    put<uint64_t>(res, 32, st.st_rdev);
+    put<int64_t>(res, 48, st.st_size);
+    put<int32_t>(res, 56, st.st_blksize);
+    put<int64_t>(res, 64, st.st_blocks);
+    put<int64_t>(res, 72, st.st_atime);
+    put<int64_t>(res, 88, st.st_mtime);
+    put<int64_t>(res, 104, st.st_ctime);
+    return res;
+}
+#endif
+} // namespace
+
+htif_syscalls::htif_syscalls(log_func info, log_func warn)
+: info(info)
+, warn(warn) {}
+
+htif_syscalls::~htif_syscalls() {
+    flush();
+#ifndef _WIN32
+    for(auto fd : fds)
+        if(fd > 2)
+            ::close(fd);
+#endif
+}
+
+iss::status htif_syscalls::execute(iss::arch_if* aif, unsigned space, uint64_t magic_mem, uint64_t fromhost) {
+    this->aif = aif;
+    this->space = space;
+    std::array<uint64_t, 8> args;
+    if(!read_guest(magic_mem, sizeof(args), args.data()))
+        return iss::Err;
+    int64_t res = dispatch(args[0], args);
+    if(exit_code)
+        return iss::Ok;
+    if(!write_guest(magic_mem, sizeof(res), &res))
+        return iss::Err;
+    if(fromhost != std::numeric_limits<uint64_t>::max()) {
+        uint64_t ack = 1;
+        if(!write_guest(fromhost, sizeof(ack), &ack))
+            return iss::Err;
+    }
+    return iss::Ok;
+}
+
+int64_t htif_syscalls::dispatch(uint64_t num, std::array<uint64_t, 8> const& args) {
+    switch(num) {
+    case SYS_write:
+        return sys_write(args[1], args[2], args[3], {});
+    case SYS_read:
+        return sys_read(args[1], args[2], args[3], {});
+    case SYS_pwrite:
+        return sys_write(args[1], args[2], args[3], args[4]);
+    case SYS_pread:
+        return sys_read(args[1], args[2], args[3], args[4]);
+    case SYS_exit:
+    case SYS_exit_group:
+        exit_code = static_cast<int64_t>(args[1]);
+        flush();
+        return 0;
+    case SYS_openat:
+        return sys_openat(args[1], args[2], args[3], args[4]);
+    case SYS_open:
+        return sys_openat(GUEST_AT_FDCWD, args[1], args[2], args[3]);
+    case SYS_close:
+        return sys_close(args[1]);
+    case SYS_brk:
+        if(args[1] >= heap_end)
+            heap_end = args[1];
+        return heap_end;
+    case SYS_gettimeofday:
+        return sys_time(args[1], false, false);
+    case SYS_clock_gettime:
+        return sys_time(args[2], true, args[1] == GUEST_CLOCK_MONOTONIC);
+    case SYS_time: {
+        auto now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        int64_t val = now;
+        if(args[1] && !write_guest(args[1], sizeof(val), &val))
+            return -EFAULT;
+        return now;
+    }
+    case SYS_getcwd:
+        return sys_getcwd(args[1], args[2]);
+#ifndef _WIN32
+    case SYS_lseek: {
+        auto fd = host_fd(args[1]);
+        if(fd < 0)
+            return -EBADF;
+        auto res = ::lseek(fd, static_cast<off_t>(args[2]), static_cast<int>(args[3]));
+        return res < 0 ? neg_errno() : res;
+    }
+    case SYS_fstat: {
+        auto fd = host_fd(args[1]);
+        return fd < 0 ? -EBADF : sys_stat(fd, {}, args[2], true);
+    }
+    case SYS_fstatat:
+    case SYS_stat:
+    case SYS_lstat: {
+        auto path = read_guest_string(num == SYS_fstatat ? args[2] : args[1]);
+        if(!path)
+            return -EFAULT;
+        if(num == SYS_fstatat)
+            return sys_stat(host_dirfd(args[1]), *path, args[3], !(args[4] & GUEST_AT_SYMLINK_NOFOLLOW));
+        return sys_stat(AT_FDCWD, *path, args[2], num == SYS_stat);
+    }
+    case SYS_unlinkat:
+    case SYS_unlink: {
+        auto path = read_guest_string(num == SYS_unlinkat ? args[2] : args[1]);
+        if(!path)
+            return -EFAULT;
+        auto res = num == SYS_unlinkat ? ::unlinkat(host_dirfd(args[1]), path->c_str(), args[3] ? AT_REMOVEDIR : 0)
+                                       : ::unlink(path->c_str());
+        return res < 0 ? neg_errno() : 0;
+    }
+    case SYS_faccessat:
+    case SYS_access: {
+        auto path = read_guest_string(num == SYS_faccessat ? args[2] : args[1]);
+        if(!path)
+            return -EFAULT;
+        auto res = num == SYS_faccessat ? ::faccessat(host_dirfd(args[1]), path->c_str(), static_cast<int>(args[3]), 0)
+                                        : ::access(path->c_str(), static_cast<int>(args[2]));
+        return res < 0 ? neg_errno() : 0;
+    }
+#endif
+    default:
+        if(warn)
+            warn("htif syscall " + std::to_string(num) + " is not supported");
+        return -ENOSYS;
+    }
+}
+
+int64_t htif_syscalls::sys_write(uint64_t fd, uint64_t buf, uint64_t len, std::optional<uint64_t> offs) {
+    auto hfd = host_fd(fd);
+    if(hfd < 0)
+        return -EBADF;
+    int64_t done = 0;
+    while(done < static_cast<int64_t>(len)) {
+        auto chunk = std::min<size_t>(len - done, max_chunk);
+        buffer.resize(chunk);
+        if(!read_guest(buf + done, chunk, buffer.data()))
+            return done ? done : -EFAULT;
+        if(!offs && (hfd == 1 || hfd == 2)) {
+            console_write(hfd - 1, reinterpret_cast<char const*>(buffer.data()), chunk);
+        } else {
+#ifndef _WIN32
+            auto res = offs ? ::pwrite(hfd, buffer.data(), chunk, static_cast<off_t>(*offs + done)) : ::write(hfd, buffer.data(), chunk);
+            if(res < 0)
+                return done ? done : neg_errno();
+            chunk = res;
+#else
+            return -ENOSYS;
+#endif
+        }
+        done += chunk;
+        if(!chunk)
+            break;
+    }
+    return done;
+}
+
+int64_t htif_syscalls::sys_read(uint64_t fd, uint64_t buf, uint64_t len, std::optional<uint64_t> offs) {
+#ifndef _WIN32
+    auto hfd = host_fd(fd);
+    if(hfd < 0)
+        return -EBADF;
+    if(hfd == 0)
+        flush();
+    int64_t done = 0;
+    while(done < static_cast<int64_t>(len)) {
+        auto chunk = std::min<size_t>(len - done, max_chunk);
+        buffer.resize(chunk);
+        auto res = offs ? ::pread(hfd, buffer.data(), chunk, static_cast<off_t>(*offs + done)) : ::read(hfd, buffer.data(), chunk);
+        if(res < 0)
+            return done ? done : neg_errno();
+        if(res && !write_guest(buf + done, res, buffer.data()))
+            return done ? done : -EFAULT;
+        done += res;
+        // short reads (end of file, terminal input) end the syscall
+        if(static_cast<size_t>(res) < chunk)
+            break;
+    }
+    return done;
+#else
+    return -ENOSYS;
+#endif
+}
+
+int64_t htif_syscalls::sys_openat(int64_t dirfd, uint64_t path_addr, uint64_t flags, uint64_t mode) {
+#ifndef _WIN32
+    auto path = read_guest_string(path_addr);
+    if(!path)
+        return -EFAULT;
+    auto fd = ::openat(host_dirfd(dirfd), path->c_str(), to_host_flags(flags), static_cast<mode_t>(mode));
+    if(fd < 0)
+        return neg_errno();
+    auto it = std::find(fds.begin(), fds.end(), -1);
+    if(it != fds.end()) {
+        *it = fd;
+        return it - fds.begin();
+    }
+    fds.push_back(fd);
+    return fds.size() - 1;
+#else
+    return -ENOSYS;
+#endif
+}
+
+int64_t htif_syscalls::sys_close(uint64_t fd) {
+    auto hfd = host_fd(fd);
+    if(hfd < 0)
+        return -EBADF;
+    // the standard streams of the simulator stay open
+#ifndef _WIN32
+    if(hfd > 2 && ::close(hfd) < 0)
+        return neg_errno();
+#endif
+    fds[fd] = -1;
+    return 0;
+}
+
+int64_t htif_syscalls::sys_stat(int host_fd, std::string const& path, uint64_t buf, bool follow) {
+#ifndef _WIN32
+    struct stat st;
+    auto res = path.empty() ? ::fstat(host_fd, &st) : ::fstatat(host_fd, path.c_str(), &st, follow ? 0 : AT_SYMLINK_NOFOLLOW);
+    if(res < 0)
+        return neg_errno();
+    auto guest_st = to_guest_stat(st);
+    return write_guest(buf, guest_st.size(), guest_st.data()) ? 0 : -EFAULT;
+#else
+    return -ENOSYS;
+#endif
+}
+
+int64_t htif_syscalls::sys_time(uint64_t buf, bool nsec, bool monotonic) {
+    // struct timeval and struct timespec both consist of a 64bit second count and a long, the long is written as 64bit
+    // value which also clears the padding on RV32
+    auto const since_epoch =
+        monotonic ? std::chrono::steady_clock::now().time_since_epoch() : std::chrono::system_clock::now().time_since_epoch();
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count();
+    std::array<int64_t, 2> val{now / 1000000000, nsec ? now % 1000000000 : now % 1000000000 / 1000};
+    return write_guest(buf, sizeof(val), val.data()) ? 0 : -EFAULT;
+}
+
+int64_t htif_syscalls::sys_getcwd(uint64_t buf, uint64_t size) {
+#ifndef _WIN32
+    std::array<char, max_path> cwd;
+    if(!::getcwd(cwd.data(), cwd.size()))
+        return neg_errno();
+    auto len = std::strlen(cwd.data()) + 1;
+    if(len > size)
+        return -ERANGE;
+    return write_guest(buf, len, cwd.data()) ? len : -EFAULT;
+#else
+    return -ENOSYS;
+#endif
+}
+
+void htif_syscalls::console_write(unsigned stream, char const* data, size_t len) {
+    auto& line = console[stream];
+    switch(console_mode) {
+    case htif_console_mode::LOG:
+        for(size_t i = 0; i < len; ++i) {
+            if(data[i] == '\n' || data[i] == '\0') {
+                if(info)
+                    info("tohost send '" + line + "'");
+                line.clear();
+            } else
+                line += data[i];
+        }
+        break;
+    case htif_console_mode::LINE: {
+        line.append(data, len);
+        auto pos = line.rfind('\n');
+        if(pos != std::string::npos) {
+            auto* f = stream ? stderr : stdout;
+            std::fwrite(line.data(), 1, pos + 1, f);
+            std::fflush(f);
+            line.erase(0, pos + 1);
+        }
+        break;
+    }
+    case htif_console_mode::EXIT:
+        line.append(data, len);
+        if(line.size() > max_console_buffer) {
+            std::fwrite(line.data(), 1, line.size(), stream ? stderr : stdout);
+            line.clear();
+        }
+        break;
+    }
+}
+
+void htif_syscalls::flush() {
+    for(auto stream = 0U; stream < console.size(); ++stream) {
+        auto& line = console[stream];
+        if(line.empty())
+            continue;
+        if(console_mode == htif_console_mode::LOG) {
+            if(info)
+                info("tohost send '" + line + "'");
+        } else {
+            auto* f = stream ? stderr : stdout;
+            std::fwrite(line.data(), 1, line.size(), f);
+            std::fflush(f);
+        }
+        line.clear();
+    }
+}
+
+bool htif_syscalls::read_guest(uint64_t addr, size_t len, void* data) {
+    return aif->read({address_type::LOGICAL, access_type::DEBUG_READ, space, addr}, len, static_cast<uint8_t*>(data)) == iss::Ok;
+}
+
+bool htif_syscalls::write_guest(uint64_t addr, size_t len, void const* data) {
+    return aif->write({address_type::LOGICAL, access_type::DEBUG_WRITE, space, addr}, len, static_cast<uint8_t const*>(data)) ==
+           iss::Ok;
+}
+
+std::optional<std::string> htif_syscalls::read_guest_string(uint64_t addr) {
+    // read in small blocks up to the next 64 byte boundary, single bytes if the guest memory ends within a block
+    std::string res;
+    std::array<char, 64> block;
+    while(res.size() < max_path) {
+        auto len = block.size() - (addr & (block.size() - 1));
+        if(!read_guest(addr, len, block.data())) {
+            if(!read_guest(addr, 1, block.data()))
+                return {};
+            len = 1;
+        }
+        auto end = std::find(block.begin(), block.begin() + len, '\0');
+        res.append(block.begin(), end);
+        if(end != block.begin() + len)
+            return res;
+        addr += len;
+    }
+    return {};
+}
+
+int htif_syscalls::host_fd(uint64_t fd) const { return fd < fds.size() ? fds[fd] : -1; }
+
+int htif_syscalls::host_dirfd(int64_t dirfd) const {
+#ifndef _WIN32
+    if(dirfd == GUEST_AT_FDCWD)
+        return AT_FDCWD;
+#endif
+    return host_fd(dirfd);
+}
+} // namespace iss
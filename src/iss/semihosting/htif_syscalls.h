@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _HTIF_SYSCALLS_H_
+#define _HTIF_SYSCALLS_H_
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iss/arch_if.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace iss {
+/**
+ * how the output written to stdout and stderr by the target is passed to the host
+ * - LOG: each line is reported via the simulator logging (default)
+ * - LINE: written to the host stdout/stderr and flushed at the end of each line
+ * - EXIT: buffered and written to the host stdout/stderr when the target exits or the buffer is full
+ */
+enum class htif_console_mode { LOG, LINE, EXIT };
+
+/**
+ * proxy for the syscalls issued by newlib/libgloss and the proxy kernel via the HTIF magic memory (a block of 8 64bit
+ * words holding the syscall number and its arguments, the result is returned in the first word). The syscall numbers
+ * and structures follow the RISC-V Linux ABI as used by riscv-pk and fesvr. Guest memory is accessed in bulk using
+ * debug accesses, file descriptors are mapped onto host file descriptors
+ */
+class htif_syscalls {
+public:
+    using log_func = std::function<void(std::string const&)>;
+
+    //! console lines are passed to info in LOG mode, unsupported syscalls are reported to warn
+    htif_syscalls(log_func info, log_func warn);
+
+    ~htif_syscalls();
+
+    void set_console_mode(htif_console_mode mode) { console_mode = mode; }
+
+    //! sets the initial program break (e.g. the end of the loaded image), brk() starts from here
+    void set_heap_start(uint64_t addr) {
+        if(addr > heap_end)
+            heap_end = addr;
+    }
+
+    /**
+     * executes the syscall described by the magic memory at magic_mem, writes the result back and acknowledges
+     * it by writing 1 to fromhost if this address is known
+     *
+     * @param aif the core used to access the guest memory
+     * @param space the memory space of the magic memory and the buffers
+     * @return Err if the magic memory could not be accessed
+     */
+    iss::status execute(iss::arch_if* aif, unsigned space, uint64_t magic_mem, uint64_t fromhost);
+
+    //! the exit code if the target called exit()
+    std::optional<int64_t> get_exit_code() const { return exit_code; }
+
+    //! writes the buffered console output
+    void flush();
+
+private:
+    int64_t dispatch(uint64_t num, std::array<uint64_t, 8> const& args);
+    int64_t sys_read(uint64_t fd, uint64_t buf, uint64_t len, std::optional<uint64_t> offs);
+    int64_t sys_write(uint64_t fd, uint64_t buf, uint64_t len, std::optional<uint64_t> offs);
+    int64_t sys_openat(int64_t dirfd, uint64_t path, uint64_t flags, uint64_t mode);
+    int64_t sys_close(uint64_t fd);
+    int64_t sys_stat(int host_fd, std::string const& path, uint64_t buf, bool follow);
+    int64_t sys_time(uint64_t buf, bool nsec, bool monotonic);
+    int64_t sys_getcwd(uint64_t buf, uint64_t size);
+    void console_write(unsigned stream, char const* data, size_t len);
+    bool read_guest(uint64_t addr, size_t len, void* data);
+    bool write_guest(uint64_t addr, size_t len, void const* data);
+    std::optional<std::string> read_guest_string(uint64_t addr);
+    int host_fd(uint64_t fd) const;
+    int host_dirfd(int64_t dirfd) const;
+
+    log_func info, warn;
+    htif_console_mode console_mode{htif_console_mode::LOG};
+    iss::arch_if* aif{nullptr};
+    unsigned space{0};
+    //! guest file descriptor to host file descriptor, -1 denotes a free slot
+    std::vector<int> fds{0, 1, 2};
+    //! pending console output of stdout and stderr
+    std::array<std::string, 2> console;
+    std::vector<uint8_t> buffer;
+    uint64_t heap_end{0};
+    std::optional<int64_t> exit_code;
+};
+} // namespace iss
+#endif /* _HTIF_SYSCALLS_H_ */
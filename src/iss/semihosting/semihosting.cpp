@@ -33,36 +33,169 @@
  ******************************************************************************/
 
 #include "semihosting.h"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <iomanip>
 #include <iss/vm_types.h>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 // explanation of syscalls can be found at https://github.com/SpinalHDL/openocd_riscv/blob/riscv_spinal/src/target/semihosting_common.h
 
 const char* SYS_OPEN_MODES_STRS[] = {"r", "rb", "r+", "r+b", "w", "wb", "w+", "w+b", "a", "ab", "a+", "a+b"};
 
-template <typename T> T sh_read_field(iss::arch_if* arch_if_ptr, T addr, int len = 4) {
-    uint8_t bytes[4];
-    auto res = arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, addr}, 4, &bytes[0]);
-    // auto res = arch_if_ptr->read(iss::address_type::PHYSICAL, iss::access_type::DEBUG_READ, 0, *parameter, 1, &character);
+//! the ticks of SYS_ELAPSED are nanoseconds of the host
+constexpr uint64_t SH_TICK_FREQ = 1000000000;
+//! max. number of bytes copied from or to the guest memory at once
+constexpr size_t SH_MAX_CHUNK = 1 << 20;
 
-    if(res != iss::Ok) {
-        return 0; // TODO THROW ERROR
-    } else
-        return static_cast<T>(bytes[0]) | (static_cast<T>(bytes[1]) << 8) | (static_cast<T>(bytes[2]) << 16) |
-               (static_cast<T>(bytes[3]) << 24);
+/**
+ * writes the semihosting output to the host files in a background thread. Consecutive writes to the same file are
+ * merged, the amount of pending output is limited so a fast target blocks instead of exhausting the host memory
+ */
+class semihosting_writer {
+public:
+    semihosting_writer()
+    : thread([this]() { run(); }) {}
+
+    ~semihosting_writer() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stop = true;
+        }
+        cv.notify_all();
+        thread.join();
+    }
+
+    void write(FILE* file, uint8_t const* data, size_t len) {
+        std::unique_lock<std::mutex> lock(mtx);
+        done_cv.wait(lock, [this]() { return pending < max_pending; });
+        if(queue.empty() || queue.back().file != file || queue.back().data.size() > max_chunk)
+            queue.push_back({file, {}});
+        queue.back().data.insert(queue.back().data.end(), data, data + len);
+        pending += len;
+        cv.notify_one();
+    }
+
+    //! waits until all pending output is written to the files
+    void drain() {
+        std::unique_lock<std::mutex> lock(mtx);
+        done_cv.wait(lock, [this]() { return queue.empty() && !busy; });
+    }
+
+private:
+    struct chunk {
+        FILE* file;
+        std::vector<uint8_t> data;
+    };
+    static constexpr size_t max_chunk = 1 << 16;
+    static constexpr size_t max_pending = 1 << 24;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while(true) {
+            cv.wait(lock, [this]() { return stop || !queue.empty(); });
+            if(queue.empty())
+                return;
+            auto c = std::move(queue.front());
+            queue.pop_front();
+            busy = true;
+            lock.unlock();
+            fwrite(c.data.data(), 1, c.data.size(), c.file);
+            fflush(c.file);
+            lock.lock();
+            busy = false;
+            pending -= c.data.size();
+            done_cv.notify_all();
+        }
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv, done_cv;
+    std::deque<chunk> queue;
+    size_t pending{0};
+    bool busy{false};
+    bool stop{false};
+    std::thread thread;
+};
+
+//! reads N consecutive fields of the parameter block at addr in one access, fails if the block is not readable
+template <typename T, size_t N> std::optional<std::array<T, N>> sh_read_fields(iss::arch_if* arch_if_ptr, T addr) {
+    std::array<T, N> res{};
+    if(arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, addr}, sizeof(res),
+                         reinterpret_cast<uint8_t*>(res.data())) != iss::Ok)
+        return {};
+    return res;
+}
+
+template <typename T> bool sh_write_mem(iss::arch_if* arch_if_ptr, T addr, size_t len, void const* data) {
+    return arch_if_ptr->write({iss::address_type::LOGICAL, iss::access_type::DEBUG_WRITE, 0, addr}, len,
+                              static_cast<uint8_t const*>(data)) == iss::Ok;
 }
 
 template <typename T> std::string sh_read_string(iss::arch_if* arch_if_ptr, T addr, T str_len) {
-    std::vector<uint8_t> buffer(str_len);
-    for(int i = 0; i < str_len; i++) {
-        buffer[i] = sh_read_field(arch_if_ptr, addr + i, 1);
-    }
-    std::string str(buffer.begin(), buffer.end());
+    std::string str(str_len, '\0');
+    if(arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, addr}, str_len,
+                         reinterpret_cast<uint8_t*>(str.data())) != iss::Ok)
+        return {};
     return str;
 }
 
+//! reads a zero terminated string in blocks up to the next 64 byte boundary, bytewise if the memory ends within a block
+template <typename T> std::string sh_read_cstring(iss::arch_if* arch_if_ptr, T addr) {
+    std::string str;
+    std::array<char, 64> block;
+    while(true) {
+        size_t len = block.size() - (addr & (block.size() - 1));
+        if(arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, addr}, len,
+                             reinterpret_cast<uint8_t*>(block.data())) != iss::Ok) {
+            len = 1;
+            if(arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, addr}, len,
+                                 reinterpret_cast<uint8_t*>(block.data())) != iss::Ok)
+                return str;
+        }
+        auto end = std::find(block.begin(), block.begin() + len, '\0');
+        str.append(block.begin(), end);
+        if(end != block.begin() + len)
+            return str;
+        addr += len;
+    }
+}
+
+template <typename T>
+semihosting_callback<T>::semihosting_callback()
+: timeVar(std::chrono::high_resolution_clock::now()) {}
+
+template <typename T> semihosting_callback<T>::~semihosting_callback() = default;
+
+template <typename T> void semihosting_callback<T>::enable_async_output(bool enable) {
+    if(enable && !writer)
+        writer = std::make_unique<semihosting_writer>();
+    else if(!enable)
+        writer.reset();
+}
+
+template <typename T> void semihosting_callback<T>::write_file(FILE* file, uint8_t const* data, size_t len) {
+    if(writer)
+        writer->write(file, data, len);
+    else
+        fwrite(data, 1, len, file);
+}
+
+template <typename T> void semihosting_callback<T>::sync_output() {
+    if(writer)
+        writer->drain();
+    else
+        fflush(stdout);
+}
+
 template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arch_if_ptr, T* call_number, T* parameter) {
     static std::map<T, FILE*> openFiles;
     static T file_count = 3;
@@ -84,6 +217,7 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         }
         auto file = openFiles[file_handle];
         openFiles.erase(file_handle);
+        sync_output();
         if(!(file == stdin || file == stdout || file == stderr)) {
             int i = fclose(file);
             *call_number = i;
@@ -94,7 +228,10 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_ELAPSED: {
-        throw std::runtime_error("Semihosting Call not Implemented");
+        // the 64bit tick count is stored in the parameter block, on RV32 it spans two fields
+        uint64_t ticks =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - timeVar).count();
+        *call_number = sh_write_mem<T>(arch_if_ptr, *parameter, sizeof(ticks), &ticks) ? 0 : -1;
         break;
     }
     case semihosting_syscalls::SYS_ERRNO: {
@@ -113,6 +250,7 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
     case semihosting_syscalls::SYS_FLEN: {
         T file_handle = *parameter;
         auto file = openFiles[file_handle];
+        sync_output();
 
         size_t currentPos = ftell(file);
         if(currentPos < 0)
@@ -124,11 +262,25 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_GET_CMDLINE: {
-        throw std::runtime_error("Semihosting Call not Implemented");
+        auto params = sh_read_fields<T, 2>(arch_if_ptr, *parameter);
+        if(!params || cmdline.size() >= (*params)[1]) {
+            *call_number = -1;
+            break;
+        }
+        // the string is returned zero terminated, its length without the terminator is stored in the second field
+        T len = cmdline.size();
+        if(!sh_write_mem<T>(arch_if_ptr, (*params)[0], cmdline.size() + 1, cmdline.c_str()) ||
+           !sh_write_mem<T>(arch_if_ptr, *parameter + sizeof(T), sizeof(T), &len)) {
+            *call_number = -1;
+            break;
+        }
+        *call_number = 0;
         break;
     }
     case semihosting_syscalls::SYS_HEAPINFO: {
-        throw std::runtime_error("Semihosting Call not Implemented");
+        // the parameter block holds the address of the 4 fields to be filled
+        auto block_addr = sh_read_fields<T, 1>(arch_if_ptr, *parameter);
+        *call_number = block_addr && sh_write_mem<T>(arch_if_ptr, (*block_addr)[0], sizeof(heap_info), heap_info.data()) ? 0 : -1;
         break;
     }
     case semihosting_syscalls::SYS_ISERROR: {
@@ -142,9 +294,12 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_OPEN: {
-        T path_str_addr = sh_read_field<T>(arch_if_ptr, *parameter);
-        T mode = sh_read_field<T>(arch_if_ptr, 4 + (*parameter));
-        T path_len = sh_read_field<T>(arch_if_ptr, 8 + (*parameter));
+        auto params = sh_read_fields<T, 3>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [path_str_addr, mode, path_len] = *params;
 
         std::string path_str = sh_read_string<T>(arch_if_ptr, path_str_addr, path_len);
 
@@ -176,11 +331,15 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_READ: {
-        T file_handle = sh_read_field<T>(arch_if_ptr, (*parameter) + 4);
-        T addr = sh_read_field<T>(arch_if_ptr, *parameter);
-        T count = sh_read_field<T>(arch_if_ptr, (*parameter) + 8);
+        auto params = sh_read_fields<T, 3>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [file_handle, addr, count] = *params;
 
         auto file = openFiles[file_handle];
+        sync_output();
 
         std::vector<uint8_t> buffer(count);
         size_t num_read = 0;
@@ -197,16 +356,13 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         } else {
             num_read = fread(buffer.data(), 1, count, file);
         }
-        buffer.resize(num_read);
-        for(int i = 0; i < num_read; i++) {
-            auto res = arch_if_ptr->write({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, addr + i}, 1, &buffer[i]);
-            if(res != iss::Ok)
-                return;
-        }
+        if(num_read && !sh_write_mem<T>(arch_if_ptr, addr, num_read, buffer.data()))
+            return;
         *call_number = count - num_read;
         break;
     }
     case semihosting_syscalls::SYS_READC: {
+        sync_output();
         uint8_t character = getchar();
         // character = getchar();
         /*if(character != iss::Ok)
@@ -216,8 +372,12 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_REMOVE: {
-        T path_str_addr = sh_read_field<T>(arch_if_ptr, *parameter);
-        T path_len = sh_read_field<T>(arch_if_ptr, (*parameter) + 4);
+        auto params = sh_read_fields<T, 2>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [path_str_addr, path_len] = *params;
         std::string path_str = sh_read_string<T>(arch_if_ptr, path_str_addr, path_len);
 
         if(remove(path_str.c_str()) < 0)
@@ -225,10 +385,12 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_RENAME: {
-        T path_str_addr_old = sh_read_field<T>(arch_if_ptr, *parameter);
-        T path_len_old = sh_read_field<T>(arch_if_ptr, (*parameter) + 4);
-        T path_str_addr_new = sh_read_field<T>(arch_if_ptr, (*parameter) + 8);
-        T path_len_new = sh_read_field<T>(arch_if_ptr, (*parameter) + 12);
+        auto params = sh_read_fields<T, 4>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [path_str_addr_old, path_len_old, path_str_addr_new, path_len_new] = *params;
 
         std::string path_str_old = sh_read_string<T>(arch_if_ptr, path_str_addr_old, path_len_old);
         std::string path_str_new = sh_read_string<T>(arch_if_ptr, path_str_addr_new, path_len_new);
@@ -236,25 +398,35 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_SEEK: {
-        T file_handle = sh_read_field<T>(arch_if_ptr, *parameter);
-        T pos = sh_read_field<T>(arch_if_ptr, (*parameter) + 1);
+        auto params = sh_read_fields<T, 2>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [file_handle, pos] = *params;
         auto file = openFiles[file_handle];
+        sync_output();
 
         int retval = fseek(file, pos, SEEK_SET);
         if(retval < 0)
             throw std::runtime_error("SYS_SEEK negative return value");
-
+        *call_number = 0;
         break;
     }
     case semihosting_syscalls::SYS_SYSTEM: {
-        T cmd_addr = sh_read_field<T>(arch_if_ptr, *parameter);
-        T cmd_len = sh_read_field<T>(arch_if_ptr, (*parameter) + 1);
+        auto params = sh_read_fields<T, 2>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [cmd_addr, cmd_len] = *params;
+        sync_output();
         std::string cmd = sh_read_string<T>(arch_if_ptr, cmd_addr, cmd_len);
         auto _ = system(cmd.c_str());
         break;
     }
     case semihosting_syscalls::SYS_TICKFREQ: {
-        throw std::runtime_error("Semihosting Call not Implemented");
+        *call_number = SH_TICK_FREQ;
         break;
     }
     case semihosting_syscalls::SYS_TIME: {
@@ -263,9 +435,12 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         break;
     }
     case semihosting_syscalls::SYS_TMPNAM: {
-        T buffer_addr = sh_read_field<T>(arch_if_ptr, *parameter);
-        T identifier = sh_read_field<T>(arch_if_ptr, (*parameter) + 1);
-        T buffer_len = sh_read_field<T>(arch_if_ptr, (*parameter) + 2);
+        auto params = sh_read_fields<T, 3>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [buffer_addr, identifier, buffer_len] = *params;
 
         if(identifier > 255) {
             *call_number = -1;
@@ -274,23 +449,35 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         std::stringstream ss;
         ss << "tmp/file-" << std::setfill('0') << std::setw(3) << identifier;
         std::string filename = ss.str();
-
-        for(int i = 0; i < buffer_len; i++) {
-            uint8_t character = filename[i];
-            auto res = arch_if_ptr->write({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, (*parameter) + i}, 1, &character);
-            if(res != iss::Ok)
-                return;
+        if(filename.size() >= buffer_len || !sh_write_mem<T>(arch_if_ptr, buffer_addr, filename.size() + 1, filename.c_str())) {
+            *call_number = -1;
+            return;
         }
+        *call_number = 0;
         break;
     }
     case semihosting_syscalls::SYS_WRITE: {
-        T file_handle = sh_read_field<T>(arch_if_ptr, (*parameter) + 4);
-        T addr = sh_read_field<T>(arch_if_ptr, *parameter);
-        T count = sh_read_field<T>(arch_if_ptr, (*parameter) + 8);
+        auto params = sh_read_fields<T, 3>(arch_if_ptr, *parameter);
+        if(!params) {
+            *call_number = -1;
+            break;
+        }
+        auto [file_handle, addr, count] = *params;
 
         auto file = openFiles[file_handle];
-        std::string str = sh_read_string<T>(arch_if_ptr, addr, count);
-        fwrite(&str[0], 1, count, file);
+        // the buffer is copied in large chunks, the number of bytes not written is returned
+        std::vector<uint8_t> buffer;
+        T written = 0;
+        while(written < count) {
+            auto len = std::min<size_t>(count - written, SH_MAX_CHUNK);
+            buffer.resize(len);
+            if(arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, static_cast<T>(addr + written)}, len,
+                                 buffer.data()) != iss::Ok)
+                break;
+            write_file(file, buffer.data(), len);
+            written += len;
+        }
+        *call_number = count - written;
         break;
     }
     case semihosting_syscalls::SYS_WRITEC: {
@@ -298,20 +485,12 @@ template <typename T> void semihosting_callback<T>::operator()(iss::arch_if* arc
         auto res = arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, *parameter}, 1, &character);
         if(res != iss::Ok)
             return;
-        putchar(character);
+        write_file(stdout, &character, 1);
         break;
     }
     case semihosting_syscalls::SYS_WRITE0: {
-        uint8_t character;
-        while(1) {
-            auto res = arch_if_ptr->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0, *parameter}, 1, &character);
-            if(res != iss::Ok)
-                return;
-            if(character == 0)
-                break;
-            putchar(character);
-            (*parameter)++;
-        }
+        auto str = sh_read_cstring<T>(arch_if_ptr, *parameter);
+        write_file(stdout, reinterpret_cast<uint8_t const*>(str.data()), str.size());
         break;
     }
     case semihosting_syscalls::USER_CMD_0x100: {
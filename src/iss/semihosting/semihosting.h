@@ -34,9 +34,13 @@
 
 #ifndef _SEMIHOSTING_H_
 #define _SEMIHOSTING_H_
+#include <array>
 #include <chrono>
+#include <cstdio>
 #include <functional>
 #include <iss/arch_if.h>
+#include <memory>
+#include <string>
 /*
  * According to:
  * "Semihosting for AArch32 and AArch64, Release 2.0"
@@ -84,11 +88,27 @@ enum class semihosting_syscalls {
     USER_CMD_0x1FF = 0x1FF,
 };
 
+class semihosting_writer;
+
 template <typename T> struct semihosting_callback {
     std::chrono::high_resolution_clock::time_point timeVar;
-    semihosting_callback()
-    : timeVar(std::chrono::high_resolution_clock::now()) {}
+    //! the command line returned by SYS_GET_CMDLINE
+    std::string cmdline;
+    //! heap base, heap limit, stack base and stack limit returned by SYS_HEAPINFO, 0 lets the C library use its defaults
+    std::array<T, 4> heap_info{};
+    semihosting_callback();
+    ~semihosting_callback();
     void operator()(iss::arch_if* arch_if_ptr, T* call_number, T* parameter);
+    /**
+     * writes the output to host files in a background thread, all other operations on files wait until the pending
+     * output is written
+     */
+    void enable_async_output(bool enable);
+
+private:
+    void write_file(FILE* file, uint8_t const* data, size_t len);
+    void sync_output();
+    std::unique_ptr<semihosting_writer> writer;
 };
 
 template <typename T> using semihosting_cb_t = std::function<void(iss::arch_if*, T*, T*)>;
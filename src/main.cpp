@@ -31,13 +31,23 @@
  *******************************************************************************/
 
 #include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <fmt/format.h>
 #include <fstream>
 #include <iostream>
+#include <iss/arch/riscv_hart_common.h>
+#include <iss/async_log_sink.h>
 #include <iss/factory.h>
+#include <iss/mem/cache.h>
+#include <iss/mem/clint.h>
 #include <iss/semihosting/semihosting.h>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <util/ities.h>
 #include <vector>
@@ -48,6 +58,7 @@
 #ifdef WITH_LLVM
 #include <iss/llvm/jit_init.h>
 #endif
+#include "iss/plugin/binary_trace.h"
 #include "iss/plugin/cycle_estimate.h"
 #include "iss/plugin/instruction_count.h"
 #include <iss/log_categories.h>
@@ -59,6 +70,145 @@
 #endif
 
 namespace po = boost::program_options;
+
+namespace {
+bool ends_with(std::string const& str, std::string const& suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// parses a cache description like 'size=16k,ways=4,line=64,repl=plru,policy=wb,hit=1,miss=20'
+iss::mem::cache_config parse_cache_config(std::string const& spec) {
+    iss::mem::cache_config cfg;
+    for(auto& token : util::split(spec, ',')) {
+        auto pos = token.find('=');
+        auto key = token.substr(0, pos);
+        auto val = pos == std::string::npos ? std::string{} : token.substr(pos + 1);
+        auto to_num = [&key, &val]() -> uint64_t {
+            if(val.empty())
+                throw std::invalid_argument("missing value for cache parameter " + key);
+            auto scale = std::toupper(val.back()) == 'K' ? 1024ULL : std::toupper(val.back()) == 'M' ? 1024ULL * 1024 : 1ULL;
+            return std::stoull(val, nullptr, 0) * scale;
+        };
+        if(key == "size")
+            cfg.size = to_num();
+        else if(key == "line")
+            cfg.line_size = to_num();
+        else if(key == "ways")
+            cfg.ways = to_num();
+        else if(key == "repl" && (val == "lru" || val == "plru" || val == "random"))
+            cfg.replacement = val == "lru"    ? iss::mem::replacement_policy::LRU
+                              : val == "plru" ? iss::mem::replacement_policy::PLRU
+                                              : iss::mem::replacement_policy::RANDOM;
+        else if(key == "policy" && (val == "wt" || val == "wb"))
+            cfg.policy = val == "wt" ? iss::mem::write_policy::WRITE_THROUGH : iss::mem::write_policy::WRITE_BACK;
+        else if(key == "alloc")
+            cfg.write_allocate = true;
+        else if(key == "data")
+            cfg.tag_only = false;
+        else if(key == "hit")
+            cfg.hit_latency = to_num();
+        else if(key == "miss")
+            cfg.miss_latency = to_num();
+        else if(key == "wb")
+            cfg.writeback_latency = to_num();
+        else if(key == "uncached" && val.find(':') != std::string::npos) {
+            cfg.uncached_base = std::stoull(val.substr(0, val.find(':')), nullptr, 0);
+            cfg.uncached_size = std::stoull(val.substr(val.find(':') + 1), nullptr, 0);
+        } else
+            throw std::invalid_argument("illegal cache parameter '" + token + "'");
+    }
+    if(!cfg.size)
+        throw std::invalid_argument("cache size missing in '" + spec + "'");
+    return cfg;
+}
+
+//! thread barrier whose participants may leave the group, like std::barrier of C++20
+class hart_barrier {
+public:
+    explicit hart_barrier(size_t count)
+    : expected(count) {}
+
+    void arrive_and_wait() {
+        std::unique_lock<std::mutex> lock(mtx);
+        auto const phase = current_phase;
+        if(++arrived >= expected)
+            complete_phase();
+        else
+            cv.wait(lock, [this, phase]() { return current_phase != phase; });
+    }
+
+    void arrive_and_drop() {
+        std::lock_guard<std::mutex> lock(mtx);
+        if(--expected && arrived >= expected)
+            complete_phase();
+    }
+
+private:
+    void complete_phase() {
+        arrived = 0;
+        ++current_phase;
+        cv.notify_all();
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    size_t expected;
+    size_t arrived{0};
+    uint64_t current_phase{0};
+};
+
+/**
+ * runs each hart in its own thread. The harts execute quantum instructions and wait for each other before starting the
+ * next quantum so that no hart gets more than one quantum ahead. A hart stopping (e.g. parked in a jump to self) leaves
+ * the group, the simulation ends when hart 0 stops or all harts reached the instruction limit
+ */
+int run_harts(std::vector<iss::vm_if*> const& vms, uint64_t limit, uint64_t quantum, bool dump, logging::log_level level) {
+    hart_barrier sync(vms.size());
+    std::atomic<bool> done{false};
+    std::vector<int> results(vms.size());
+    std::vector<std::exception_ptr> errors(vms.size());
+    std::vector<std::thread> threads;
+    // vm_if::start reports each quantum, the aggregated numbers are reported below
+    LOGGER(DEFAULT)::set_reporting_level(std::min(level, logging::WARN));
+    auto const start = std::chrono::high_resolution_clock::now();
+    for(auto i = 0U; i < vms.size(); ++i)
+        threads.emplace_back([&, i]() {
+            auto* instr_if = vms[i]->get_arch()->get_instrumentation_if();
+            try {
+                while(!done) {
+                    auto const target = std::min(limit, instr_if->get_instr_count() + quantum);
+                    results[i] = vms[i]->start(target, dump, iss::finish_cond_e::ICOUNT_LIMIT | iss::finish_cond_e::JUMP_TO_SELF);
+                    if(instr_if->get_instr_count() < target || target == limit)
+                        break;
+                    sync.arrive_and_wait();
+                }
+            } catch(...) {
+                errors[i] = std::current_exception();
+            }
+            if(i == 0)
+                done = true;
+            sync.arrive_and_drop();
+        });
+    for(auto& t : threads)
+        t.join();
+    auto const millis = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count());
+    LOGGER(DEFAULT)::set_reporting_level(level);
+    uint64_t total = 0;
+    for(auto i = 0U; i < vms.size(); ++i) {
+        auto const count = vms[i]->get_arch()->get_instrumentation_if()->get_instr_count();
+        CPPLOG(INFO) << "hart " << i << ": executed " << count << " instructions resulting in " << (count * 0.001 / millis) << "MIPS";
+        total += count;
+    }
+    CPPLOG(INFO) << "Executed " << total << " instructions on " << vms.size() << " harts during " << millis << "ms resulting in "
+                 << (total * 0.001 / millis) << "MIPS (" << (total * 0.001 / millis / vms.size()) << "MIPS per hart)";
+    for(auto& e : errors)
+        if(e)
+            std::rethrow_exception(e);
+    return results[0];
+}
+} // namespace
+
 int main(int argc, char* argv[]) {
     /*
      *  Define and parse the program options
@@ -80,6 +230,18 @@ int main(int argc, char* argv[]) {
         ("mem,m", po::value<std::string>(), "the memory input file")
         ("plugin,p", po::value<std::vector<std::string>>(), "plugin to activate")
         ("backend", po::value<std::string>()->default_value("interp"), "the ISS backend to use, options are: interp, llvm, tcc, asmjit")
+        ("icache", po::value<std::string>(), "enable the instruction cache model, e.g. size=16k,ways=4,line=64,repl=lru|plru|random,hit=0,miss=20[,data]")
+        ("dcache", po::value<std::string>(), "enable the data cache model, takes additionally policy=wt|wb,alloc,wb=<cycles>,uncached=<base>:<size>. With several harts only the timing (no 'data') is modelled")
+        ("clint", po::value<std::string>()->implicit_value("0x2000000"), "enable a CLINT timer at the given base address, idle time in WFI is skipped")
+        ("timer-divider", po::value<uint64_t>()->default_value(100000000 / 32768 - 1), "number of cycles per mtime tick of the CLINT timer")
+        ("idle-loops", po::value<std::string>()->implicit_value("skip"), "detect polling loops and skip the idle time, 'log' additionally reports each loop")
+        ("htif-console", po::value<std::string>(), "output of the HTIF write syscall: 'log' (default) as log messages, 'line' to stdout/stderr flushed at each newline, 'exit' to stdout/stderr flushed at exit")
+        ("semihosting-cmdline", po::value<std::string>(), "command line returned by the semihosting call SYS_GET_CMDLINE, defaults to the name of the ELF file")
+        ("semihosting-heap", po::value<std::string>(), "heap base, heap limit, stack base and stack limit returned by SYS_HEAPINFO, e.g. 0x80100000,0x80200000,0x80300000,0x80200000")
+        ("semihosting-async", "write the semihosting output to the host files in a background thread")
+        ("async-log", po::value<std::string>()->implicit_value(""), "write the log and disassembly files in a background thread, takes size=<bytes>[k|m],policy=block|drop. File names ending in .gz are compressed")
+        ("harts", po::value<unsigned>()->default_value(1), "number of harts sharing the memory, each hart is simulated in its own thread")
+        ("quantum", po::value<uint64_t>()->default_value(10000), "number of instructions a hart executes before synchronizing with the other harts")
         ("isa", po::value<std::string>()->default_value("rv32imac_m"), "core or isa name to use for simulation, use '?' to get list");
     // clang-format on
     auto parsed = po::command_line_parser(argc, argv).options(desc).allow_unregistered().run();
@@ -108,9 +270,32 @@ int main(int argc, char* argv[]) {
     LOGGER(connection)::set_reporting_level(l);
     LOGGER(dbt_rise_iss)::set_reporting_level(l);
     LOGGER(disass)::set_reporting_level(l);
+    // the loggers are switched back to stderr before the sinks are closed
+    struct log_sink_list : std::vector<std::unique_ptr<iss::async_log_sink>> {
+        ~log_sink_list() {
+            if(empty())
+                return;
+            LOG_OUTPUT(DEFAULT)::stream() = stderr;
+            LOG_OUTPUT(connection)::stream() = stderr;
+            LOG_OUTPUT(dbt_rise_iss)::stream() = stderr;
+            LOG_OUTPUT(disass)::stream() = stderr;
+            clear();
+        }
+    } log_sinks;
+    auto open_log_file = [&clim, &log_sinks](std::string const& name) -> FILE* {
+        if(clim.count("async-log") || ends_with(name, ".gz")) {
+            auto cfg = iss::async_log_sink::parse_config(clim.count("async-log") ? clim["async-log"].as<std::string>() : "", name);
+            auto& sink = log_sinks.emplace_back(std::make_unique<iss::async_log_sink>(name, cfg));
+            if(sink->get_stream())
+                return sink->get_stream();
+            log_sinks.pop_back();
+            CPPLOG(WARN) << "Could not create an asynchronous sink for " << name << ", writing it directly";
+        }
+        return fopen(name.c_str(), "w");
+    };
     if(clim.count("logfile")) {
         // configure the connection logger
-        auto f = fopen(clim["logfile"].as<std::string>().c_str(), "w");
+        auto f = open_log_file(clim["logfile"].as<std::string>());
         LOG_OUTPUT(DEFAULT)::stream() = f;
         LOG_OUTPUT(connection)::stream() = f;
         LOG_OUTPUT(dbt_rise_iss)::stream() = f;
@@ -131,6 +316,21 @@ int main(int argc, char* argv[]) {
         iss::cpu_ptr cpu{nullptr};
         semihosting_callback<uint32_t> cb{};
         semihosting_cb_t<uint32_t> semihosting_cb = [&cb](iss::arch_if* i, uint32_t* a0, uint32_t* a1) { cb(i, a0, a1); };
+        if(clim.count("semihosting-cmdline"))
+            cb.cmdline = clim["semihosting-cmdline"].as<std::string>();
+        else if(clim.count("elf"))
+            cb.cmdline = clim["elf"].as<std::vector<std::string>>().front();
+        if(clim.count("semihosting-heap")) {
+            auto values = util::split(clim["semihosting-heap"].as<std::string>(), ',');
+            if(values.size() != cb.heap_info.size()) {
+                CPPLOG(ERR) << "Illegal semihosting heap info '" << clim["semihosting-heap"].as<std::string>()
+                            << "', expected 4 comma separated values" << std::endl;
+                return 127;
+            }
+            for(auto i = 0U; i < values.size(); ++i)
+                cb.heap_info[i] = std::stoul(values[i], nullptr, 0);
+        }
+        cb.enable_async_output(clim.count("semihosting-async"));
         std::string isa_opt(clim["isa"].as<std::string>());
         if(isa_opt.size() == 0 || isa_opt == "?") {
             std::unordered_map<std::string, std::vector<std::string>> core_by_backend;
@@ -163,6 +363,75 @@ int main(int argc, char* argv[]) {
             CPPLOG(ERR) << "Could not create vm for isa " << isa_opt << " and backend " << clim["backend"].as<std::string>() << std::endl;
             return 127;
         }
+        auto* hart = dynamic_cast<iss::arch::riscv_hart_if*>(cpu.get());
+        auto const num_harts = std::max(1U, clim["harts"].as<unsigned>());
+        if(!hart && (clim.count("icache") || clim.count("dcache") || clim.count("clint") || clim.count("idle-loops") ||
+                     clim.count("htif-console") || num_harts > 1)) {
+            CPPLOG(ERR) << "Cache and timer models, idle loop detection, HTIF console modes or multiple harts are not supported by isa "
+                        << isa_opt << std::endl;
+            return 127;
+        }
+        std::vector<iss::arch::riscv_hart_if*> harts;
+        if(hart)
+            harts.push_back(hart);
+        // the other harts are created alike, only hart 0 is connected to the debugger
+        std::vector<std::pair<iss::cpu_ptr, iss::vm_ptr>> secondaries;
+        for(auto id = 1U; id < num_harts; ++id) {
+            iss::cpu_ptr c{nullptr};
+            iss::vm_ptr v{nullptr};
+            std::tie(c, v) = f.create(isa_opt + ":" + clim["backend"].as<std::string>(), 0, &semihosting_cb);
+            auto* h = dynamic_cast<iss::arch::riscv_hart_if*>(c.get());
+            h->set_mhartid(id);
+            // all harts access the main memory of hart 0, each through its own element executing its HTIF requests
+            h->share_main_memory(*hart);
+            harts.push_back(h);
+            secondaries.emplace_back(std::move(c), std::move(v));
+        }
+        if(clim.count("idle-loops")) {
+            auto mode = clim["idle-loops"].as<std::string>();
+            if(mode != "skip" && mode != "log") {
+                CPPLOG(ERR) << "Illegal idle loop mode '" << mode << "', valid values are 'skip' and 'log'" << std::endl;
+                return 127;
+            }
+            for(auto* h : harts)
+                h->set_idle_loop_mode(mode == "log" ? iss::arch::idle_loop_mode::LOG : iss::arch::idle_loop_mode::SKIP);
+        }
+        if(clim.count("htif-console")) {
+            auto mode = clim["htif-console"].as<std::string>();
+            if(mode != "log" && mode != "line" && mode != "exit") {
+                CPPLOG(ERR) << "Illegal HTIF console mode '" << mode << "', valid values are 'log', 'line' and 'exit'" << std::endl;
+                return 127;
+            }
+            auto const console_mode = mode == "log"    ? iss::htif_console_mode::LOG
+                                      : mode == "line" ? iss::htif_console_mode::LINE
+                                                       : iss::htif_console_mode::EXIT;
+            for(auto* h : harts)
+                h->set_htif_console_mode(console_mode);
+        }
+        if(clim.count("clint")) {
+            auto base = std::stoull(clim["clint"].as<std::string>(), nullptr, 0);
+            // all harts share one CLINT, hart n accesses its msip and mtimecmp registers through its own port
+            auto clint = std::make_shared<iss::mem::clint>(
+                iss::mem::clint_config{.base = base, .divider = std::max<uint64_t>(1, clim["timer-divider"].as<uint64_t>())}, harts.size());
+            for(auto i = 0U; i < harts.size(); ++i) {
+                auto port = std::make_unique<iss::mem::clint::port>(clint, *harts[i], i);
+                // the timer deadline is checked after each instruction
+                (i ? secondaries[i - 1].second : vm)->register_plugin(port->get_timer_check());
+                harts[i]->get_memory_hierarchy().insert_before_last(std::move(port));
+            }
+        }
+        if(clim.count("icache") || clim.count("dcache")) {
+            auto icache_cfg = clim.count("icache") ? parse_cache_config(clim["icache"].as<std::string>()) : iss::mem::cache_config{};
+            auto dcache_cfg = clim.count("dcache") ? parse_cache_config(clim["dcache"].as<std::string>()) : iss::mem::cache_config{};
+            // each hart has a private cache model, holding data would make the harts see stale values of each other
+            if(harts.size() > 1 && ((icache_cfg.size && !icache_cfg.tag_only) || (dcache_cfg.size && !dcache_cfg.tag_only))) {
+                CPPLOG(ERR) << "Caches holding data (option 'data') are not coherent between harts, use them with a single hart only";
+                return 1;
+            }
+            for(auto* h : harts)
+                h->get_memory_hierarchy().insert_before_last(std::make_unique<iss::mem::cache>(
+                    icache_cfg, dcache_cfg, h->get_cycle_offset(), h->get_tohost(), h->get_fromhost(), &h->get_hpm()));
+        }
         if(clim.count("plugin")) {
             for(std::string const& opt_val : clim["plugin"].as<std::vector<std::string>>()) {
                 std::string plugin_name = opt_val;
@@ -172,6 +441,11 @@ int main(int argc, char* argv[]) {
                     plugin_name = opt_val.substr(0, found);
                     arg = opt_val.substr(found + 1, opt_val.size());
                 }
+                if(plugin_name == "bt") {
+                    auto* bt_plugin = new iss::plugin::binary_trace(arg);
+                    vm->register_plugin(*bt_plugin);
+                    plugin_list.push_back(bt_plugin);
+                } else
 #if defined(WITH_PLUGINS)
                 if(plugin_name == "ic") {
                     auto* ic_plugin = new iss::plugin::instruction_count(arg);
@@ -196,7 +470,7 @@ int main(int argc, char* argv[]) {
                     } else
 #endif
                     {
-                        CPPLOG(ERR) << "Unknown plugin name: " << plugin_name << ", valid names are 'ce', 'ic'" << std::endl;
+                        CPPLOG(ERR) << "Unknown plugin name: " << plugin_name << ", valid names are 'bt', 'ce', 'ic'" << std::endl;
                         return 127;
                     }
                 }
@@ -204,19 +478,28 @@ int main(int argc, char* argv[]) {
         }
         if(clim.count("disass")) {
             vm->setDisassEnabled(true);
+            for(auto& s : secondaries)
+                s.second->setDisassEnabled(true);
             LOGGER(disass)::print_time() = false;
             auto file_name = clim["disass"].as<std::string>();
             if(file_name.length() > 0) {
-                LOG_OUTPUT(disass)::stream() = fopen(file_name.c_str(), "w");
+                LOG_OUTPUT(disass)::stream() = open_log_file(file_name);
                 LOGGER(disass)::print_severity() = false;
             }
         }
+        // the memory is shared, loading the files into the other harts sets up their symbols and HTIF addresses
+        auto load_file = [&vm, &secondaries](std::string const& name) {
+            auto res = vm->get_arch()->load_file(name);
+            for(auto& s : secondaries)
+                s.second->get_arch()->load_file(name);
+            return res;
+        };
         uint64_t start_address = 0;
         if(clim.count("mem"))
-            vm->get_arch()->load_file(clim["mem"].as<std::string>());
+            load_file(clim["mem"].as<std::string>());
         if(clim.count("elf"))
             for(std::string input : clim["elf"].as<std::vector<std::string>>()) {
-                auto start_addr = vm->get_arch()->load_file(input);
+                auto start_addr = load_file(input);
                 if(start_addr.second)
                     start_address = start_addr.first;
                 else {
@@ -225,7 +508,7 @@ int main(int argc, char* argv[]) {
                 }
             }
         for(std::string input : args) {
-            auto start_addr = vm->get_arch()->load_file(input); // treat remaining arguments as elf files
+            auto start_addr = load_file(input); // treat remaining arguments as elf files
             if(start_addr.second)
                 start_address = start_addr.first;
             else {
@@ -238,6 +521,8 @@ int main(int argc, char* argv[]) {
             start_address = str.find("0x") == 0 ? std::stoull(str.substr(2), nullptr, 16) : std::stoull(str, nullptr, 10);
         }
         vm->reset(start_address);
+        for(auto& s : secondaries)
+            s.second->reset(start_address);
         auto limit = clim["ilimit"].as<uint64_t>();
         auto cond = iss::finish_cond_e::JUMP_TO_SELF;
         if(clim.count("flimit")) {
@@ -246,7 +531,14 @@ int main(int argc, char* argv[]) {
         } else {
             cond = cond | iss::finish_cond_e::ICOUNT_LIMIT;
         }
-        res = vm->start(limit, dump, cond);
+        if(secondaries.empty())
+            res = vm->start(limit, dump, cond);
+        else {
+            std::vector<iss::vm_if*> vms{vm.get()};
+            for(auto& s : secondaries)
+                vms.push_back(s.second.get());
+            res = run_harts(vms, clim["ilimit"].as<uint64_t>(), std::max<uint64_t>(1, clim["quantum"].as<uint64_t>()), dump, l);
+        }
 
         auto instr_if = vm->get_arch()->get_instrumentation_if();
         // this assumes a single input file
@@ -258,7 +550,7 @@ int main(int argc, char* argv[]) {
         if(sym_table.find("begin_signature") != std::end(sym_table) && sym_table.find("end_signature") != std::end(sym_table)) {
             auto start_addr = sym_table["begin_signature"];
             auto end_addr = sym_table["end_signature"];
-            std::array<uint8_t, 4> data;
+            std::vector<uint8_t> data(end_addr > start_addr ? (end_addr - start_addr + 3) & ~3ULL : 0);
             std::ofstream file;
             std::string filename = fmt::format("{}.signature", isa_opt);
             std::replace(std::begin(filename), std::end(filename), '|', '_');
@@ -270,14 +562,20 @@ int main(int argc, char* argv[]) {
                 return 1;
             }
             LOGGER(DEFAULT)::set_reporting_level(logging::ERR);
-            for(auto addr = start_addr; addr < end_addr; addr += data.size()) {
-                vm->get_arch()->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0 /*iss::arch::traits<ARCH>::MEM*/, addr},
+            // the signature is read in one go and written as a single block
+            if(auto* h = dynamic_cast<iss::arch::riscv_hart_if*>(vm->get_arch()))
+                h->read_debug_range(start_addr, data.size(), data.data());
+            else
+                vm->get_arch()->read({iss::address_type::LOGICAL, iss::access_type::DEBUG_READ, 0 /*iss::arch::traits<ARCH>::MEM*/,
+                                      start_addr},
                                      data.size(), data.data());
-
+            fmt::memory_buffer out;
+            for(size_t i = 0; i < data.size(); i += 4) {
                 // TODO : obey Target endianess
-                uint32_t to_print = (data[3] << 24) + (data[2] << 16) + (data[1] << 8) + data[0];
-                file << std::hex << fmt::format("{:08x}", to_print) << std::dec << std::endl;
+                uint32_t to_print = (data[i + 3] << 24) + (data[i + 2] << 16) + (data[i + 1] << 8) + data[i];
+                fmt::format_to(std::back_inserter(out), "{:08x}\n", to_print);
             }
+            file.write(out.data(), out.size());
         }
     } catch(std::exception& e) {
         CPPLOG(ERR) << "Unhandled Exception reached the top of main: " << e.what() << ", application will now exit" << std::endl;
@@ -0,0 +1,265 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <iss/plugin/binary_trace_format.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace iss::plugin;
+
+namespace {
+//! buffered reader of the trace file, a record is parsed again after refilling if it was incomplete
+struct trace_reader {
+    FILE* file;
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(1 << 20);
+    size_t start{0}, end{0};
+    bool eof{false};
+
+    //! moves the unread data to the front and reads more, the buffer grows if it does not hold a complete record
+    bool refill() {
+        if(eof)
+            return false;
+        if(start == 0 && end == buffer.size())
+            buffer.resize(2 * buffer.size());
+        std::memmove(buffer.data(), buffer.data() + start, end - start);
+        end -= start;
+        start = 0;
+        auto n = fread(buffer.data() + end, 1, buffer.size() - end, file);
+        end += n;
+        eof = n == 0;
+        return n > 0;
+    }
+};
+
+struct mem_write {
+    uint64_t addr;
+    unsigned length;
+    uint8_t data[256];
+};
+
+struct record {
+    uint8_t tag;
+    uint64_t pc;
+    uint32_t instr;
+    uint64_t trap;
+    unsigned priv;
+    //! the number of instructions given by the end marker
+    uint64_t count;
+    std::vector<std::pair<unsigned, uint64_t>> regs;
+    std::vector<mem_write> mem;
+};
+
+struct decoder {
+    unsigned xlen{32};
+    uint64_t expected_pc{0};
+    unsigned priv{3};
+    std::unordered_map<uint64_t, uint32_t> words;
+
+    //! parses one record from p, returns the number of bytes used or 0 if the data is incomplete
+    size_t parse(uint8_t const* p, size_t avail, record& rec) {
+        size_t n = 1, cnt;
+        if(avail < 1)
+            return 0;
+        rec.tag = p[0];
+        rec.regs.clear();
+        rec.mem.clear();
+        rec.trap = 0;
+        if(rec.tag & rvbt::TAG_END) {
+            if(!(cnt = rvbt::get_varint(p + n, avail - n, rec.count)))
+                return 0;
+            return n + cnt;
+        }
+        rec.pc = expected_pc;
+        if(rec.tag & rvbt::TAG_PC) {
+            int64_t delta;
+            if(!(cnt = rvbt::get_svarint(p + n, avail - n, delta)))
+                return 0;
+            n += cnt;
+            rec.pc += delta;
+        }
+        if(xlen == 32)
+            rec.pc &= 0xffffffff;
+        if(rec.tag & rvbt::TAG_INSTR) {
+            if(n + 2 > avail)
+                return 0;
+            rec.instr = p[n] | p[n + 1] << 8;
+            if(rvbt::instr_length(rec.instr) == 4) {
+                if(n + 4 > avail)
+                    return 0;
+                rec.instr |= p[n + 2] << 16 | static_cast<uint32_t>(p[n + 3]) << 24;
+            }
+            n += rvbt::instr_length(rec.instr);
+        } else {
+            auto it = words.find(rec.pc);
+            rec.instr = it != words.end() ? it->second : 0;
+        }
+        if(rec.tag & rvbt::TAG_TRAP) {
+            if(!(cnt = rvbt::get_varint(p + n, avail - n, rec.trap)))
+                return 0;
+            n += cnt;
+        }
+        // the record holds the level the instruction was executed in
+        rec.priv = priv;
+        auto next_priv = priv;
+        if(rec.tag & rvbt::TAG_PRIV) {
+            if(n + 1 > avail)
+                return 0;
+            next_priv = p[n++];
+        }
+        if(rec.tag & rvbt::TAG_REGS) {
+            if(n + 1 > avail)
+                return 0;
+            auto count = p[n++];
+            for(auto i = 0U; i < count; ++i) {
+                uint64_t val;
+                if(n + 1 > avail || !(cnt = rvbt::get_varint(p + n + 1, avail - n - 1, val)))
+                    return 0;
+                rec.regs.emplace_back(p[n], val);
+                n += 1 + cnt;
+            }
+        }
+        if(rec.tag & rvbt::TAG_MEM) {
+            uint64_t count;
+            if(!(cnt = rvbt::get_varint(p + n, avail - n, count)))
+                return 0;
+            n += cnt;
+            rec.mem.resize(count);
+            for(auto& w : rec.mem) {
+                if(!(cnt = rvbt::get_varint(p + n, avail - n, w.addr)))
+                    return 0;
+                n += cnt;
+                if(n + 1 > avail || n + 1 + p[n] > avail)
+                    return 0;
+                w.length = p[n++];
+                std::memcpy(w.data, p + n, w.length);
+                n += w.length;
+            }
+        }
+        // the state is only updated once the record is complete
+        if(rec.tag & rvbt::TAG_INSTR)
+            words[rec.pc] = rec.instr;
+        priv = next_priv;
+        expected_pc = rec.pc + rvbt::instr_length(rec.instr);
+        return n;
+    }
+};
+
+void print_text(record const& rec, unsigned xlen) {
+    auto const w = xlen / 4;
+    printf("%c 0x%0*" PRIx64 " 0x%0*x", "USHM"[rec.priv & 3], w, rec.pc, rvbt::instr_length(rec.instr) * 2, rec.instr);
+    if(rec.tag & rvbt::TAG_TRAP)
+        printf(" trap=0x%" PRIx64, rec.trap);
+    for(auto& r : rec.regs)
+        printf(" x%u=0x%0*" PRIx64, r.first, w, r.second);
+    for(auto& m : rec.mem) {
+        printf(" [0x%0*" PRIx64 "]=0x", w, m.addr);
+        for(auto i = m.length; i > 0; --i)
+            printf("%02x", m.data[i - 1]);
+    }
+    printf("\n");
+}
+
+//! mimics the commit log of spike (--log-commits) to allow comparing traces
+void print_spike(record const& rec, unsigned xlen) {
+    auto const w = xlen / 4;
+    printf("core   0: %u 0x%0*" PRIx64 " (0x%0*x)", rec.priv, w, rec.pc, rvbt::instr_length(rec.instr) * 2, rec.instr);
+    for(auto& r : rec.regs)
+        printf(" x%-2u 0x%0*" PRIx64, r.first, w, r.second);
+    for(auto& m : rec.mem) {
+        uint64_t val = 0;
+        std::memcpy(&val, m.data, std::min<unsigned>(m.length, sizeof(val)));
+        printf(" mem 0x%0*" PRIx64 " 0x%0*" PRIx64, w, m.addr, 2 * std::min<unsigned>(m.length, sizeof(val)), val);
+    }
+    printf("\n");
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    bool spike = false;
+    char const* file_name = nullptr;
+    for(auto i = 1; i < argc; ++i) {
+        if(std::string(argv[i]) == "--spike")
+            spike = true;
+        else
+            file_name = argv[i];
+    }
+    if(!file_name) {
+        printf("Usage: rvbt-decode [--spike] <trace file>\n");
+        return 1;
+    }
+    trace_reader rd{fopen(file_name, "rb")};
+    if(!rd.file) {
+        fprintf(stderr, "Could not open %s\n", file_name);
+        return 1;
+    }
+    while(rd.end < rvbt::header_size && rd.refill())
+        ;
+    if(rd.end < rvbt::header_size || std::memcmp(rd.buffer.data(), rvbt::magic, sizeof(rvbt::magic)) != 0 ||
+       rd.buffer[4] != rvbt::version) {
+        fprintf(stderr, "%s is not a binary trace of version %u\n", file_name, rvbt::version);
+        return 1;
+    }
+    decoder dec;
+    dec.xlen = rd.buffer[5];
+    rd.start = rvbt::header_size;
+    record rec;
+    uint64_t count = 0;
+    while(true) {
+        auto n = dec.parse(rd.buffer.data() + rd.start, rd.end - rd.start, rec);
+        if(!n) {
+            if(rd.refill())
+                continue;
+            fprintf(stderr, "trace ends without end marker after %" PRIu64 " instructions\n", count);
+            return 2;
+        }
+        rd.start += n;
+        if(rec.tag & rvbt::TAG_END) {
+            if(rec.count != count)
+                fprintf(stderr, "trace contains %" PRIu64 " instructions but %" PRIu64 " were recorded\n", count, rec.count);
+            break;
+        }
+        if(spike)
+            print_spike(rec, dec.xlen);
+        else
+            print_text(rec, dec.xlen);
+        count++;
+    }
+    fclose(rd.file);
+    return 0;
+}
@@ -39,6 +39,7 @@
 #include "sc2core_if.h"
 #include "util/delegate.h"
 #include "util/logging.h"
+#include <atomic>
 #include <iostream>
 #include <iss/arch/riscv_hart_common.h>
 #include <iss/iss.h>
@@ -64,7 +65,10 @@ public:
         this->csr_rd_cb[iss::arch::time] = MK_CSR_RD_CB(read_time);
         if(sizeof(reg_t) == 4)
             this->csr_rd_cb[iss::arch::timeh] = MK_CSR_RD_CB(read_time);
+        this->csr_inline.reset(iss::arch::time);
+        this->csr_inline.reset(iss::arch::timeh);
         this->memories.replace_last(*this);
+        this->set_read_burst_handler([owner](uint64_t bytes) { owner->set_read_burst(bytes); });
         this->set_hartid = util::delegate<void(unsigned)>::from<this_class, &this_class::_set_mhartid>(this);
         this->get_arch_if = util::delegate<iss::arch_if*()>::from<this_class, &this_class::_get_arch_if>(this);
         this->get_mode = util::delegate<uint32_t()>::from<this_class, &this_class::_get_mode>(this);
@@ -90,11 +94,14 @@ public:
         this->local_irq = util::delegate<void(short, bool)>::from<this_class, &this_class::_local_irq_mt>(this);
         this->register_csr_rd = util::delegate<void(unsigned, rd_csr_f)>::from<this_class, &this_class::_register_csr_rd_mt>(this);
         this->register_csr_wr = util::delegate<void(unsigned, wr_csr_f)>::from<this_class, &this_class::_register_csr_wr_mt>(this);
+        status.publish(this->reg.PRIV, this->state.mstatus.backing.val);
+        publish_status = true;
     }
 
     virtual ~core2sc_adapter() {}
 
     void enable_disass(bool enable) override {
+        this->trap_log_enabled = enable;
         if(enable)
             this->disass_func =
                 util::delegate<void(uint64_t, std::string const&, bool)>::from<this_class, &this_class::record_n_print_disass>(this);
@@ -108,7 +115,21 @@ public:
     };
 
     void notify_phase(iss::arch_if::exec_phase p) {
+        if(unlikely(publish_status) && p == iss::arch_if::ISTART)
+            status.update(this->reg.PRIV, this->state.mstatus.backing.val);
         if(p == iss::arch_if::ISTART && !first) {
+            if(unlikely(owner->ff_active)) {
+                if(this->reg.icount < owner->ff_icount.load(std::memory_order_relaxed) && this->reg.PC != owner->ff_pc) {
+                    // the cycles are handed to the core complex in bulk once the quantum is used up
+                    auto const cycles = this->instr_if.get_total_cycles();
+                    if(cycles >= ff_sync_cycle) {
+                        owner->sync(cycles);
+                        ff_sync_cycle = cycles + std::max<uint64_t>(owner->get_cycles_to_sync(), 1);
+                    }
+                    return;
+                }
+                owner->end_fast_forward();
+            }
             auto cycle_incr = owner->get_last_bus_cycles();
             if(cycle_incr > 1)
                 this->instr_if.update_last_instr_cycles(cycle_incr);
@@ -213,22 +234,8 @@ public:
                 return iss::Ok;
             }
             if(device == 0 && command == 0) {
-                std::array<uint64_t, 8> loaded_payload;
-                auto res = owner->read_mem({addr.type, addr.access, addr.space, payload_addr}, 8 * sizeof(uint64_t),
-                                           reinterpret_cast<uint8_t*>(loaded_payload.data()))
-                               ? iss::Ok
-                               : iss::Err;
-                if(res == iss::Err) {
-                    SCCERR(owner->hier_name()) << "Syscall read went wrong";
-                    return iss::Ok;
-                }
-                uint64_t syscall_num = loaded_payload.at(0);
-                if(syscall_num == 64) // SYS_WRITE
-                    return this->execute_sys_write(this, loaded_payload, PLAT::MEM);
-                SCCERR(owner->hier_name()) << "tohost syscall with number 0x" << std::hex << syscall_num << std::dec << " (" << syscall_num
-                                           << ") not implemented";
-                this->reg.trap_state = std::numeric_limits<uint32_t>::max();
-                this->interrupt_sim = payload_addr;
+                // errors are reported by the hart, the simulation continues like after an unsupported syscall
+                this->execute_htif_syscall(this, payload_addr, PLAT::MEM);
                 return iss::Ok;
             }
             SCCERR(owner->hier_name()) << "tohost functionality not implemented for device " << device << " and command " << command;
@@ -268,6 +275,13 @@ public:
         wfi_inst.store(false, std::memory_order_relaxed);
     }
 
+    //! an idle hart may run until the next sync point, the other models can only act from then on
+    uint64_t skip_idle_cycles(uint64_t max_cycles) override {
+        auto const cycles = std::min(max_cycles, owner->get_cycles_to_sync());
+        this->cycle_offset += cycles;
+        return cycles;
+    }
+
     void cancel_wait() {
         if(wfi_inst.load(std::memory_order_relaxed) == true) {
             SCCDEBUG(owner->hier_name()) << "Trigger debugger stop event";
@@ -285,10 +299,7 @@ private:
     iss::arch_if* _get_arch_if() { return this; }
 
     uint32_t _get_mode() { return this->reg.PRIV; }
-    uint32_t _get_mode_mt() {
-        std::shared_lock<mutex_t> lock(sync_mtx);
-        return this->reg.PRIV;
-    }
+    uint32_t _get_mode_mt() { return status.read().first; }
 
     void _set_interrupt_execution(bool v) { this->interrupt_sim = v ? 1 : 0; }
     void _set_interrupt_execution_mt(bool v) {
@@ -303,10 +314,7 @@ private:
     }
 
     uint64_t _get_state() { return this->state.mstatus.backing.val; }
-    uint64_t _get_state_mt() {
-        std::shared_lock<mutex_t> lock(sync_mtx);
-        return this->state.mstatus.backing.val;
-    }
+    uint64_t _get_state_mt() { return status.read().second; }
 
     void _local_irq(short id, bool value) {
         reg_t mask = 0;
@@ -358,8 +366,48 @@ private:
     sc_core::sc_event debugger_stop_evt;
     unsigned to_host_wr_cnt = 0;
     bool first{true};
+    //! the cycle count at which the next sync is due in fast forward mode
+    uint64_t ff_sync_cycle{0};
     std::atomic<bool> wfi_inst{false};
     mutex_t sync_mtx;
+    /**
+     * privilege mode and mstatus published by the ISS thread at the start of each instruction in multi-threaded
+     * simulations. Readers retry while an update is in progress (seqlock) so they never block the ISS thread
+     */
+    struct status_snapshot {
+        std::atomic<unsigned> seq{0};
+        std::atomic<uint32_t> mode{0};
+        std::atomic<uint64_t> state{0};
+
+        void publish(uint32_t m, uint64_t s) {
+            auto const n = seq.load(std::memory_order_relaxed);
+            seq.store(n + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            mode.store(m, std::memory_order_relaxed);
+            state.store(s, std::memory_order_relaxed);
+            seq.store(n + 2, std::memory_order_release);
+        }
+        //! called by the ISS thread, the only writer, so it can compare w/o synchronization
+        void update(uint32_t m, uint64_t s) {
+            if(m != mode.load(std::memory_order_relaxed) || s != state.load(std::memory_order_relaxed))
+                publish(m, s);
+        }
+
+        std::pair<uint32_t, uint64_t> read() const {
+            unsigned before, after;
+            uint32_t m;
+            uint64_t s;
+            do {
+                before = seq.load(std::memory_order_acquire);
+                m = mode.load(std::memory_order_relaxed);
+                s = state.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = seq.load(std::memory_order_relaxed);
+            } while(before != after || (before & 1));
+            return {m, s};
+        }
+    } status;
+    bool publish_status{false};
 };
 } // namespace sysc
 #endif /* _SYSC_CORE2SC_ADAPTER_H_ */
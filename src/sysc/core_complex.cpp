@@ -32,6 +32,8 @@
 
 // clang-format off
 #include "core_complex.h"
+#include <iss/arch/elf_image.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/encoderdecoder.h>
 #include <iss/debugger/server.h>
@@ -53,6 +55,7 @@
 #include <scc/report.h>
 #include <util/ities.h>
 #include <array>
+#include <iss/plugin/binary_trace.h>
 #include <iss/plugin/cycle_estimate.h>
 #include <iss/plugin/instruction_count.h>
 #include <util/ities.h>
@@ -166,6 +169,8 @@ void core_complex<BUSWIDTH, QK>::create_cpu(std::string const& type, std::string
             SCCFATAL() << "Could not create vm for isa " << type << " and backend " << backend;
     } else {
         core->set_hartid(hart_id);
+        // the interpreter caches the disassembly per instruction, the JIT backends pass temporary strings
+        trc.set_stable_disass(backend == "interp");
         auto* srv = debugger::server<debugger::gdb_session>::get();
         if(srv)
             tgt_adapter = srv->get_target(0); // FIXME: add core_id
@@ -193,6 +198,10 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::i
         if(lut_entry.get_granted_access() != tlm::tlm_dmi::DMI_ACCESS_NONE && end <= lut_entry.get_end_address() + 1) {
             fetch_lut.removeEntry(lut_entry);
         }
+        if(fetch_mru.overlaps(start, end))
+            fetch_mru = dmi_mru_entry();
+        if(fetch_buf.overlaps(start, end))
+            fetch_buf.invalidate();
     });
     dbus.register_invalidate_direct_mem_ptr([this](uint64_t start, uint64_t end) -> void {
         for(auto& read_lut : dmi_read_luts) {
@@ -207,6 +216,10 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::i
                 write_lut.removeEntry(lut_entry);
             }
         }
+        for(auto* mru : {&read_mru, &write_mru})
+            for(auto& e : *mru)
+                if(e.overlaps(start, end))
+                    e = dmi_mru_entry();
     });
 
     auto& type = GET_PROP_VALUE(core_type);
@@ -225,6 +238,7 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::i
     for(auto i = 0U; i < clint_irq_i.size(); ++i)
         clint_irq_i[i].register_nb_transport([this, i](tlm::scc::tlm_signal_gp<bool>& gp, tlm::tlm_phase& p, sc_core::sc_time& t) {
             core->local_irq(i, gp.get_value());
+            request_sync();
             return tlm::TLM_COMPLETED;
         });
 #else
@@ -252,11 +266,29 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::i
 template <unsigned int BUSWIDTH, typename QK> core_complex<BUSWIDTH, QK>::~core_complex() {
     for(auto* p : plugin_list)
         delete p;
+    if(ff_used) {
+        using seconds = std::chrono::duration<double>;
+        // the simulation may have been stopped while the ISS was still running
+        auto const end = run_end == std::chrono::steady_clock::time_point{} ? std::chrono::steady_clock::now() : run_end;
+        auto const total = vm->get_arch()->get_instrumentation_if()->get_instr_count();
+        if(ff_active)
+            ff_instructions = total;
+        auto const switched = ff_active ? end : ff_end;
+        SCCINFO(SCMOD) << "fast forward phase: " << ff_instructions << " instructions in " << seconds(switched - run_start).count()
+                       << "s, timed phase: " << total - ff_instructions << " instructions in " << seconds(end - switched).count()
+                       << "s wall clock time";
+    }
     if(post_run_stats.get_value()) {
         auto instr_if = vm->get_arch()->get_instrumentation_if();
         auto instrs = instr_if->get_instr_count();
         auto cycles = instr_if->get_total_cycles();
         SCCINFO(SCMOD) << "Ran " << instrs << " instructions in " << cycles << " cycles";
+        if(dbus_transactions && instrs)
+            SCCINFO(SCMOD) << "Issued " << dbus_transactions << " dbus transactions, "
+                           << static_cast<double>(dbus_transactions) / static_cast<double>(instrs) << " per instruction";
+        if(fetch_buf.fetches)
+            SCCINFO(SCMOD) << "Fetched " << fetch_buf.fetches << " instructions w/o DMI using " << fetch_buf.transactions
+                           << " transactions, " << fetch_buf.delay / static_cast<double>(fetch_buf.fetches) << " per instruction";
     }
 }
 
@@ -270,6 +302,24 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::b
     if(disass)
         core->enable_disass(true);
     vm->setDisassEnabled(disass || instr_trace);
+#ifndef CWR_SYSTEMC
+    fast_forward.register_post_write_callback([this](cci::cci_param_write_event<bool> const& ev) {
+        if(!ev.new_value && ff_active)
+            ff_icount.store(0, std::memory_order_relaxed);
+    });
+#endif
+    if(auto idle_mode = GET_PROP_VALUE(idle_loops)) {
+        if(auto* hart = dynamic_cast<iss::arch::riscv_hart_if*>(core->get_arch_if()))
+            hart->set_idle_loop_mode(idle_mode > 1 ? iss::arch::idle_loop_mode::LOG : iss::arch::idle_loop_mode::SKIP);
+        else
+            SCCWARN(SCMOD) << "idle loop detection is not supported by core type " << GET_PROP_VALUE(core_type);
+    }
+    if(auto size = GET_PROP_VALUE(fetch_buffer_size)) {
+        if(size & (size - 1))
+            SCCWARN(SCMOD) << "fetch_buffer_size needs to be a power of 2, fetch buffer disabled";
+        else
+            fetch_buf.data.resize(size);
+    }
     if(GET_PROP_VALUE(plugins).length()) {
         auto p = util::split(GET_PROP_VALUE(plugins), ';');
         for(std::string const& opt_val : p) {
@@ -288,6 +338,10 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::b
                 auto* plugin = new iss::plugin::cycle_estimate(filename);
                 vm->register_plugin(*plugin);
                 plugin_list.push_back(plugin);
+            } else if(plugin_name == "bt") {
+                auto* plugin = new iss::plugin::binary_trace(found != std::string::npos ? filename : "");
+                vm->register_plugin(*plugin);
+                plugin_list.push_back(plugin);
             } else {
 #ifndef WIN32
                 std::array<char const*, 1> a{{filename.c_str()}};
@@ -326,6 +380,31 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::s
             }
         }
     }
+    if(GET_PROP_VALUE(fast_forward)) {
+        ff_active = ff_used = true;
+        if(auto icount = GET_PROP_VALUE(fast_forward_icount))
+            ff_icount.store(icount, std::memory_order_relaxed);
+        std::string until = GET_PROP_VALUE(fast_forward_until);
+        if(until.size()) {
+            size_t pos = 0;
+            try {
+                ff_pc = std::stoull(until, &pos, 0);
+            } catch(std::exception const&) {
+                pos = 0;
+            }
+            if(pos != until.size()) {
+                ff_pc = std::numeric_limits<uint64_t>::max();
+                for(auto& s : util::split(GET_PROP_VALUE(elf_file), ',')) {
+                    iss::arch::elf_image image;
+                    if(image.open(s))
+                        if(auto addr = image.find_symbol(until))
+                            ff_pc = *addr;
+                }
+                if(ff_pc == std::numeric_limits<uint64_t>::max())
+                    SCCWARN(SCMOD) << "fast forward target '" << until << "' not found in the ELF files";
+            }
+        }
+    }
     if(GET_PROP_VALUE(show_memory_map)) {
         auto result = tlm::scc::gather_memory(dbus.get_base_port());
         SCCINFO(SCOBJ) << "DBUS memory map:\n" << result.to_string();
@@ -333,6 +412,9 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::s
 }
 
 template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::disass_output(uint64_t pc, std::string const& instr_str) {
+    if(ff_active || !trc.is_recording())
+        return;
+    sync_pending(); // keep the time stamps of the trace exact
     trc.disass_output(pc, instr_str, lvl[core->get_mode()], core->get_state());
 }
 
@@ -361,6 +443,7 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::c
     for(auto i = 0U; i < clint_irq_i.size(); ++i) {
         if(clint_irq_i[i].event()) {
             core->local_irq(i, clint_irq_i[i].read());
+            request_sync();
         }
     }
 }
@@ -369,6 +452,7 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::c
 template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::run() {
     reset(GET_PROP_VALUE(reset_address));
     wait(SC_ZERO_TIME); // separate from elaboration phase
+    run_start = std::chrono::steady_clock::now();
     do {
         wait(SC_ZERO_TIME);
         if(rst_i.read()) {
@@ -380,9 +464,13 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::r
             wait(curr_clk.value_changed_event());
         }
         quantum_keeper.reset(sc_core::sc_time_stamp());
+        next_sync_cycle = 0;
         core->set_interrupt_execution(false);
         run_iss();
     } while(!core->get_interrupt_execution());
+    run_end = std::chrono::steady_clock::now();
+    if(ff_active)
+        end_fast_forward();
     if(finish_evt_inuse)
         finish_evt.notify();
     else {
@@ -391,19 +479,34 @@ template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::r
     }
 }
 
+template <unsigned int BUSWIDTH, typename QK> void core_complex<BUSWIDTH, QK>::end_fast_forward() {
+    ff_active = false;
+    ff_end = std::chrono::steady_clock::now();
+    auto* instr_if = vm->get_arch()->get_instrumentation_if();
+    ff_instructions = instr_if->get_instr_count();
+    // the latencies of the accesses during the fast mode were not accounted
+    ibus_inc = dbus_inc = 0;
+    SCCINFO(SCMOD) << "switching to timed mode after " << ff_instructions << " instructions at pc 0x" << std::hex << instr_if->get_pc();
+}
+
 template <unsigned int BUSWIDTH, typename QK>
 bool core_complex<BUSWIDTH, QK>::read_mem(const addr_t& addr, unsigned length, uint8_t* const data) {
     // basically checking for mem_type_e in CORENAME.h
     bool is_fetch = addr.space == std::numeric_limits<decltype(addr.space)>::max() ? true : false;
-    auto& dmi_lut = is_fetch ? fetch_lut : get_read_lut(addr.space);
-    auto lut_entry = dmi_lut.getEntry(addr.val);
-    if(lut_entry.get_granted_access() != tlm::tlm_dmi::DMI_ACCESS_NONE && (addr.val + length) <= (lut_entry.get_end_address() + 1)) {
-        auto offset = addr.val - lut_entry.get_start_address();
-        std::copy(lut_entry.get_dmi_ptr() + offset, lut_entry.get_dmi_ptr() + offset + length, data);
+    dmi_mru_entry local;
+    auto* mru = is_fetch ? &fetch_mru : get_mru(read_mru, addr.space);
+    auto& entry = mru ? *mru : local;
+    if(likely(entry.hit(addr.val, length, curr_clk.read())) ||
+       fill_mru(entry, is_fetch ? fetch_lut : get_read_lut(addr.space), addr.val, length, true)) {
+        auto offset = addr.val - entry.start;
+        std::copy(entry.ptr + offset, entry.ptr + offset + length, data);
         if(is_fetch)
-            ibus_inc += lut_entry.get_read_latency() / curr_clk;
-        else
-            dbus_inc += lut_entry.get_read_latency() / curr_clk;
+            ibus_inc += entry.latency;
+        else {
+            dbus_inc += entry.latency;
+            if(unlikely(read_burst.remaining)) // keep the burst within the data of the instruction
+                read_burst.remaining = read_burst.remaining > length ? read_burst.remaining - length : 0;
+        }
 #ifndef NDEBUG
         SCCTRACEALL(this->name()) << "[local offset: +" << quantum_keeper.get_local_time() << "]: finish dmi_read_mem(0x" << std::hex
                                   << addr.val << ") : 0x"
@@ -412,23 +515,18 @@ bool core_complex<BUSWIDTH, QK>::read_mem(const addr_t& addr, unsigned length, u
                                                     : (unsigned)*data);
 #endif
         return true;
+    } else if(is_fetch && fetch_buf.data.size() && read_fetch_buffer(addr.val, length, data)) {
+        return true;
+    } else if(!is_fetch && read_burst.remaining && read_from_burst(addr, length, data)) {
+        return true;
     } else {
-        tlm::tlm_generic_payload gp;
-        gp.set_command(tlm::TLM_READ_COMMAND);
+        auto& gp = get_payload(addr.space, is_fetch);
         gp.set_address(addr.val);
         gp.set_data_ptr(data);
         gp.set_data_length(length);
         gp.set_streaming_width(length);
+        sync_pending(); // the transaction needs the exact local time
         sc_time delay = quantum_keeper.get_local_time();
-        sysc::memspace::tlm_memspace_extension<> mem_spc(static_cast<memspace::common>(addr.space));
-        if(!is_fetch)
-            gp.set_extension(&mem_spc);
-        tlm::scc::initiator_id_extension id_ext{mhartid.get_value()};
-        gp.set_extension(&id_ext);
-        DEFER {
-            gp.set_extension<tlm::scc::initiator_id_extension>(nullptr);
-            gp.set_extension<sysc::memspace::tlm_memspace_extension<>>(nullptr);
-        };
         auto pre_delay = delay;
         exec_b_transport(gp, delay, is_fetch);
         if(pre_delay > delay) {
@@ -440,6 +538,13 @@ bool core_complex<BUSWIDTH, QK>::read_mem(const addr_t& addr, unsigned length, u
             else
                 dbus_inc += incr;
         }
+        if(is_fetch) {
+            fetch_buf.fetches++;
+            fetch_buf.transactions++;
+            if(delay > pre_delay)
+                fetch_buf.delay += delay - pre_delay;
+        } else
+            dbus_transactions++;
         SCCTRACE(this->name()) << "[local offset: +" << delay << "]: finish read_mem(0x" << std::hex << addr.val << ") : 0x"
                                << (length == 4   ? *(uint32_t*)data
                                    : length == 2 ? *(uint16_t*)data
@@ -451,6 +556,7 @@ bool core_complex<BUSWIDTH, QK>::read_mem(const addr_t& addr, unsigned length, u
             gp.set_address(addr.val);
             tlm_dmi_ext dmi_data;
             if(exec_get_direct_mem_ptr(gp, dmi_data)) {
+                auto& dmi_lut = is_fetch ? fetch_lut : get_read_lut(addr.space);
                 if(dmi_data.is_read_allowed() && (addr.val + length - 1) <= dmi_data.get_end_address())
                     dmi_lut.addEntry(dmi_data, dmi_data.get_start_address(), dmi_data.get_end_address() - dmi_data.get_start_address() + 1);
             }
@@ -461,11 +567,17 @@ bool core_complex<BUSWIDTH, QK>::read_mem(const addr_t& addr, unsigned length, u
 
 template <unsigned int BUSWIDTH, typename QK>
 bool core_complex<BUSWIDTH, QK>::write_mem(const addr_t& addr, unsigned length, const uint8_t* const data) {
-    auto lut_entry = get_write_lut(addr.space).getEntry(addr.val);
-    if(lut_entry.get_granted_access() != tlm::tlm_dmi::DMI_ACCESS_NONE && (addr.val + length) <= (lut_entry.get_end_address() + 1)) {
-        auto offset = addr.val - lut_entry.get_start_address();
-        std::copy(data, data + length, lut_entry.get_dmi_ptr() + offset);
-        dbus_inc += lut_entry.get_write_latency() / curr_clk;
+    if(unlikely(fetch_buf.overlaps(addr.val, addr.val + length - 1)))
+        fetch_buf.invalidate(); // self modifying code
+    if(unlikely(read_burst.overlaps(addr.val, addr.val + length - 1)))
+        read_burst.invalidate();
+    dmi_mru_entry local;
+    auto* mru = get_mru(write_mru, addr.space);
+    auto& entry = mru ? *mru : local;
+    if(likely(entry.hit(addr.val, length, curr_clk.read())) || fill_mru(entry, get_write_lut(addr.space), addr.val, length, false)) {
+        auto offset = addr.val - entry.start;
+        std::copy(data, data + length, entry.ptr + offset);
+        dbus_inc += entry.latency;
 #ifndef NDEBUG
         SCCTRACEALL(this->name()) << "[local offset: +" << quantum_keeper.get_local_time() << "]: finish dmi_write_mem(0x" << std::hex
                                   << addr.val << ") : 0x"
@@ -477,23 +589,17 @@ bool core_complex<BUSWIDTH, QK>::write_mem(const addr_t& addr, unsigned length,
     } else {
         write_buf.resize(length);
         std::copy(data, data + length, write_buf.begin()); // need to copy as TLM does not guarantee data integrity
-        tlm::tlm_generic_payload gp;
+        auto& gp = get_payload(addr.space, false);
         gp.set_command(tlm::TLM_WRITE_COMMAND);
         gp.set_address(addr.val);
         gp.set_data_ptr(write_buf.data());
         gp.set_data_length(length);
         gp.set_streaming_width(length);
+        sync_pending(); // the transaction needs the exact local time
         sc_time delay = quantum_keeper.get_local_time();
-        sysc::memspace::tlm_memspace_extension<> mem_spc(static_cast<memspace::common>(addr.space));
-        gp.set_extension(&mem_spc);
-        tlm::scc::initiator_id_extension id_ext{mhartid.get_value()};
-        gp.set_extension(&id_ext);
-        DEFER {
-            gp.set_extension<tlm::scc::initiator_id_extension>(nullptr);
-            gp.set_extension<sysc::memspace::tlm_memspace_extension<>>(nullptr);
-        };
         auto pre_delay = delay;
         exec_b_transport(gp, delay);
+        dbus_transactions++;
         if(pre_delay > delay)
             quantum_keeper.reset();
         else
@@ -549,6 +655,131 @@ template <unsigned int BUSWIDTH, typename QK> util::range_lut<tlm_dmi_ext>& core
 template <unsigned int BUSWIDTH, typename QK> util::range_lut<tlm_dmi_ext>& core_complex<BUSWIDTH, QK>::get_write_lut(unsigned space) {
     return get_lut(dmi_write_luts, space);
 };
+template <unsigned int BUSWIDTH, typename QK>
+bool core_complex<BUSWIDTH, QK>::fill_mru(dmi_mru_entry& entry, util::range_lut<tlm_dmi_ext>& lut, uint64_t addr, unsigned length,
+                                          bool read) {
+    auto lut_entry = lut.getEntry(addr);
+    if(lut_entry.get_granted_access() == tlm::tlm_dmi::DMI_ACCESS_NONE || (addr + length) > (lut_entry.get_end_address() + 1))
+        return false;
+    entry.start = lut_entry.get_start_address();
+    entry.end = lut_entry.get_end_address();
+    entry.ptr = lut_entry.get_dmi_ptr();
+    entry.clk = curr_clk.read();
+    // truncated like the increments of the bus cycles
+    entry.latency = static_cast<uint64_t>((read ? lut_entry.get_read_latency() : lut_entry.get_write_latency()) / entry.clk);
+    return true;
+}
+
+template <unsigned int BUSWIDTH, typename QK>
+bool core_complex<BUSWIDTH, QK>::read_fetch_buffer(uint64_t addr, unsigned length, uint8_t* const data) {
+    auto const line_size = fetch_buf.data.size();
+    auto const line_start = addr & ~static_cast<uint64_t>(line_size - 1);
+    if(addr + length > line_start + line_size || line_start == fetch_buf.failed)
+        return false;
+    if(!fetch_buf.hit(addr, length)) {
+        fetch_buf.invalidate();
+        auto& gp = get_payload(0, true);
+        gp.set_address(line_start);
+        gp.set_data_ptr(fetch_buf.data.data());
+        gp.set_data_length(line_size);
+        gp.set_streaming_width(line_size);
+        sync_pending(); // the transaction needs the exact local time
+        sc_time delay = quantum_keeper.get_local_time();
+        auto pre_delay = delay;
+        exec_b_transport(gp, delay, true);
+        fetch_buf.transactions++;
+        if(pre_delay > delay) {
+            quantum_keeper.reset();
+        } else {
+            ibus_inc += (delay - quantum_keeper.get_local_time()) / curr_clk;
+            fetch_buf.delay += delay - pre_delay;
+        }
+        SCCTRACE(this->name()) << "[local offset: +" << delay << "]: finish fetch line read(0x" << std::hex << line_start << ")";
+        if(gp.get_response_status() != tlm::TLM_OK_RESPONSE) {
+            // e.g. the line extends beyond the end of the memory
+            fetch_buf.failed = line_start;
+            return false;
+        }
+        fetch_buf.start = line_start;
+        fetch_buf.end = line_start + line_size - 1;
+        if(gp.is_dmi_allowed() && !GET_PROP_VALUE(disable_dmi)) {
+            gp.set_address(addr);
+            gp.set_data_length(length);
+            tlm_dmi_ext dmi_data;
+            if(exec_get_direct_mem_ptr(gp, dmi_data)) {
+                if(dmi_data.is_read_allowed() && (addr + length - 1) <= dmi_data.get_end_address())
+                    fetch_lut.addEntry(dmi_data, dmi_data.get_start_address(),
+                                       dmi_data.get_end_address() - dmi_data.get_start_address() + 1);
+            }
+        }
+    }
+    fetch_buf.fetches++;
+    auto offset = addr - fetch_buf.start;
+    std::copy(fetch_buf.data.data() + offset, fetch_buf.data.data() + offset + length, data);
+    return true;
+}
+
+template <unsigned int BUSWIDTH, typename QK>
+bool core_complex<BUSWIDTH, QK>::read_from_burst(const addr_t& addr, unsigned length, uint8_t* const data) {
+    auto const remaining = read_burst.remaining;
+    read_burst.remaining = remaining > length ? remaining - length : 0;
+    if(!read_burst.hit(addr.val, length)) {
+        // the first element needing a transaction starts the burst, it does not cross the page it is in
+        auto const burst_len = std::min<uint64_t>(remaining, (addr.val | 0xfff) + 1 - addr.val);
+        if(burst_len <= length)
+            return false;
+        read_burst.invalidate();
+        read_burst.data.resize(burst_len);
+        auto& gp = get_payload(addr.space, false);
+        gp.set_address(addr.val);
+        gp.set_data_ptr(read_burst.data.data());
+        gp.set_data_length(burst_len);
+        gp.set_streaming_width(burst_len);
+        sync_pending(); // the transaction needs the exact local time
+        sc_time delay = quantum_keeper.get_local_time();
+        auto pre_delay = delay;
+        exec_b_transport(gp, delay);
+        dbus_transactions++;
+        if(pre_delay > delay)
+            quantum_keeper.reset();
+        else
+            dbus_inc += (delay - quantum_keeper.get_local_time()) / curr_clk;
+        SCCTRACE(this->name()) << "[local offset: +" << delay << "]: finish burst read(0x" << std::hex << addr.val << ", " << std::dec
+                               << burst_len << ")";
+        if(gp.get_response_status() != tlm::TLM_OK_RESPONSE) {
+            // the element accesses report the error of the failing element
+            read_burst.remaining = 0;
+            return false;
+        }
+        read_burst.start = addr.val;
+        read_burst.end = addr.val + burst_len - 1;
+    }
+    auto offset = addr.val - read_burst.start;
+    std::copy(read_burst.data.data() + offset, read_burst.data.data() + offset + length, data);
+    return true;
+}
+
+template <unsigned int BUSWIDTH, typename QK>
+tlm::tlm_generic_payload& core_complex<BUSWIDTH, QK>::get_payload(unsigned space, bool is_fetch) {
+    auto const idx = is_fetch ? 0U : space + 1;
+    if(idx >= payloads.size())
+        payloads.resize(idx + 1);
+    auto& gp = payloads[idx];
+    if(unlikely(!gp)) {
+        // the payload owns the extensions and frees them when it is destroyed
+        gp = std::make_unique<tlm::tlm_generic_payload>();
+        gp->set_extension(new tlm::scc::initiator_id_extension{mhartid.get_value()});
+        if(!is_fetch)
+            gp->set_extension(new sysc::memspace::tlm_memspace_extension<>(static_cast<memspace::common>(space)));
+    }
+    gp->set_command(tlm::TLM_READ_COMMAND);
+    gp->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    gp->set_dmi_allowed(false);
+    gp->set_byte_enable_ptr(nullptr);
+    gp->set_byte_enable_length(0);
+    return *gp;
+}
+
 template <unsigned int BUSWIDTH, typename QK>
 util::range_lut<tlm_dmi_ext>& core_complex<BUSWIDTH, QK>::get_lut(lut_vec_t& luts, unsigned space) {
     if(space >= luts.size()) {
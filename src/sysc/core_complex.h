@@ -57,6 +57,9 @@
 #define USE_TLM_SIGNAL
 #endif
 #endif
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <tlm>
 #include <tlm_utils/tlm_quantumkeeper.h>
@@ -130,6 +133,24 @@ public:
 
     cci::cci_param<bool> post_run_stats{"post_run_stats", false};
 
+    //! idle loop detection: 0=off, 1=skip the idle time until the next sync point, 2=skip and log the loops
+    cci::cci_param<unsigned> idle_loops{"idle_loops", 0};
+
+    //! size in bytes (power of 2) of the line buffer for instruction fetches without DMI, 0 disables it
+    cci::cci_param<unsigned> fetch_buffer_size{"fetch_buffer_size", 0};
+
+    /**
+     * start in the functional fast mode where bus latencies are ignored and the quantum keeper is only called at the end
+     * of a quantum. It ends when a trigger below fires or when false is written to the parameter
+     */
+    cci::cci_param<bool> fast_forward{"fast_forward", false};
+
+    //! instruction count ending the fast mode, 0 disables this trigger
+    cci::cci_param<uint64_t> fast_forward_icount{"fast_forward_icount", 0};
+
+    //! address or symbol of the ELF files ending the fast mode when it is reached
+    cci::cci_param<std::string> fast_forward_until{"fast_forward_until", ""};
+
     core_complex(sc_core::sc_module_name const& name);
 
 #else
@@ -159,6 +180,16 @@ public:
 
     scml_property<bool> post_run_stats{"post_run_stats", false};
 
+    scml_property<unsigned> idle_loops{"idle_loops", 0};
+
+    scml_property<unsigned> fetch_buffer_size{"fetch_buffer_size", 0};
+
+    scml_property<bool> fast_forward{"fast_forward", false};
+
+    scml_property<unsigned long long> fast_forward_icount{"fast_forward_icount", 0};
+
+    scml_property<std::string> fast_forward_until{"fast_forward_until", ""};
+
     core_complex(sc_core::sc_module_name const& name)
     : sc_module(name)
     , local_irq_i{"local_irq_i", 16}
@@ -171,6 +202,11 @@ public:
     , dump_ir{"dump_ir", false}
     , mhartid{"mhartid", 0}
     , plugins{"plugins", ""}
+    , idle_loops{"idle_loops", 0}
+    , fetch_buffer_size{"fetch_buffer_size", 0}
+    , fast_forward{"fast_forward", false}
+    , fast_forward_icount{"fast_forward_icount", 0}
+    , fast_forward_until{"fast_forward_until", ""}
     , fetch_lut(tlm_dmi_ext())
     , read_lut(tlm_dmi_ext())
     , write_lut(tlm_dmi_ext()) {
@@ -187,12 +223,27 @@ public:
         return mem_incr > 1 ? mem_incr : 1;
     }
 
+    /**
+     * called at the start of each instruction. The cycles are only accumulated and handed to the quantum keeper when
+     * the end of the quantum is reached or a sync was requested, bus accesses w/o DMI flush them before the transaction
+     */
     void sync(uint64_t cycle) override {
-        auto core_inc = curr_clk * (cycle - last_sync_cycle);
-        quantum_keeper.check_and_sync(core_inc);
-        last_sync_cycle = cycle;
+        pending_cycle = cycle;
+        if(likely(cycle < next_sync_cycle) && !sync_requested.load(std::memory_order_relaxed))
+            return;
+        sync_pending();
+    }
+
+    void end_fast_forward() override;
+
+    void set_read_burst(uint64_t bytes) override {
+        read_burst.remaining = bytes;
+        if(!bytes)
+            read_burst.invalidate();
     }
 
+    uint64_t get_cycles_to_sync() override { return next_sync_cycle > pending_cycle ? next_sync_cycle - pending_cycle : 0; }
+
     bool read_mem(const iss::addr_t& a, unsigned length, uint8_t* const data) override;
 
     bool write_mem(const iss::addr_t& a, unsigned length, const uint8_t* const data) override;
@@ -253,8 +304,15 @@ protected:
     exec_b_transport(tlm::tlm_generic_payload& gp, sc_core::sc_time& delay, bool is_fetch = false) {
         quantum_keeper.execute_on_sysc([this, &gp, &delay, is_fetch]() {
             auto& sckt = is_fetch ? ibus : dbus;
-            gp.set_extension(trc.get_recording_extension(is_fetch));
+            auto* rec = trc.get_recording_extension(is_fetch);
+            if(rec)
+                gp.set_extension(rec);
             sckt->b_transport(gp, delay);
+            // the payload is reused, the recording extension belongs to this transaction only
+            if(rec) {
+                gp.clear_extension(rec);
+                rec->free();
+            }
         });
     }
     template <typename U = QK>
@@ -284,8 +342,15 @@ protected:
     typename std::enable_if<std::is_same<U, tlm::scc::quantumkeeper_st>::value>::type
     exec_b_transport(tlm::tlm_generic_payload& gp, sc_core::sc_time& delay, bool is_fetch = false) {
         auto& sckt = is_fetch ? ibus : dbus;
-        gp.set_extension(trc.get_recording_extension(is_fetch));
+        auto* rec = trc.get_recording_extension(is_fetch);
+        if(rec)
+            gp.set_extension(rec);
         sckt->b_transport(gp, delay);
+        // the payload is reused, the recording extension belongs to this transaction only
+        if(rec) {
+            gp.clear_extension(rec);
+            rec->free();
+        }
     }
     template <typename U = QK>
     typename std::enable_if<std::is_same<U, tlm::scc::quantumkeeper_st>::value, bool>::type
@@ -302,12 +367,38 @@ protected:
     ///////////////////////////////////////////////////////////////////////////////
     //
     ///////////////////////////////////////////////////////////////////////////////
+    //! hands the cycles accumulated since the last call to the quantum keeper and computes the next sync point
+    void sync_pending() {
+        sync_requested.store(false, std::memory_order_relaxed);
+        quantum_keeper.check_and_sync(curr_clk * (pending_cycle - last_sync_cycle));
+        last_sync_cycle = pending_cycle;
+        auto const quantum = tlm::tlm_global_quantum::instance().compute_local_quantum();
+        auto const local_time = quantum_keeper.get_local_time();
+        auto const clk = curr_clk.read();
+        auto const cycles = quantum > local_time && clk > sc_core::SC_ZERO_TIME ? static_cast<uint64_t>((quantum - local_time) / clk) : 0;
+        next_sync_cycle = pending_cycle + std::max<uint64_t>(cycles, 1);
+    }
+
+    //! forces a sync at the start of the next instruction, e.g. after an interrupt changed
+    void request_sync() { sync_requested.store(true, std::memory_order_relaxed); }
+
     uint64_t last_sync_cycle = 0;
+    //! the cycle count seen at the start of the current instruction
+    uint64_t pending_cycle = 0;
+    //! the cycle count at which the quantum is used up
+    uint64_t next_sync_cycle = 0;
+    std::atomic<bool> sync_requested{false};
     util::range_lut<tlm_dmi_ext> fetch_lut{tlm_dmi_ext()};
     inline util::range_lut<tlm_dmi_ext>& get_read_lut(unsigned space);
     inline util::range_lut<tlm_dmi_ext>& get_write_lut(unsigned space);
 
     QK quantum_keeper;
+    //! pre-initialised payloads with their extensions, index 0 is used for fetches, index space+1 for data accesses
+    std::vector<std::unique_ptr<tlm::tlm_generic_payload>> payloads;
+    //! returns the payload of the socket and memory space reset to a read command w/o data
+    tlm::tlm_generic_payload& get_payload(unsigned space, bool is_fetch);
+    //! number of dbus transactions, used to report the transactions per instruction
+    uint64_t dbus_transactions{0};
     std::vector<uint8_t> write_buf;
     sc_core::sc_signal<sc_core::sc_time> curr_clk;
     uint64_t ibus_inc{0}, dbus_inc{0};
@@ -316,6 +407,10 @@ protected:
     iss::debugger::target_adapter_if* tgt_adapter{nullptr};
     instr_recorder<QK> trc{quantum_keeper};
     std::unique_ptr<scc::tick2time> t2t;
+    //! wall clock time stamps of the phases of a fast forward run
+    std::chrono::steady_clock::time_point run_start, ff_end, run_end;
+    uint64_t ff_instructions{0};
+    bool ff_used{false};
     sc_core::sc_event finish_evt{"finish_evt"};
     bool finish_evt_inuse{false};
 
@@ -326,6 +421,73 @@ private:
     lut_vec_t dmi_read_luts{8, util::range_lut<tlm_dmi_ext>(tlm_dmi_ext())};
     lut_vec_t dmi_write_luts{8, util::range_lut<tlm_dmi_ext>(tlm_dmi_ext())};
     util::range_lut<tlm_dmi_ext>& get_lut(lut_vec_t& luts, unsigned space);
+    /**
+     * the most recently used DMI region of a memory space and access direction, almost all accesses hit it so the
+     * range_lut lookup and the conversion of the latency into cycles are done only when switching regions
+     */
+    struct dmi_mru_entry {
+        uint64_t start{1}, end{0};
+        uint8_t* ptr{nullptr};
+        uint64_t latency{0};
+        //! the clock period the latency was converted with
+        sc_core::sc_time clk;
+
+        bool hit(uint64_t addr, unsigned length, sc_core::sc_time const& curr) const {
+            return addr >= start && addr + length - 1 <= end && clk == curr;
+        }
+
+        bool overlaps(uint64_t s, uint64_t e) const { return start <= e && s <= end; }
+    };
+    dmi_mru_entry fetch_mru;
+    std::array<dmi_mru_entry, 8> read_mru, write_mru;
+    dmi_mru_entry* get_mru(std::array<dmi_mru_entry, 8>& mru, unsigned space) { return space < mru.size() ? &mru[space] : nullptr; }
+    //! looks up the region in the lut and fills entry if it is found
+    bool fill_mru(dmi_mru_entry& entry, util::range_lut<tlm_dmi_ext>& lut, uint64_t addr, unsigned length, bool read);
+    /**
+     * aligned block of code read with a single ibus transaction if the memory does not grant DMI. It is refilled
+     * when a fetch leaves the line and dropped on a DMI invalidation or a write into it
+     */
+    struct fetch_line_buffer {
+        std::vector<uint8_t> data;
+        uint64_t start{1}, end{0};
+        //! a line the target did not respond to with TLM_OK_RESPONSE, fetched instruction by instruction
+        uint64_t failed{1};
+        //! fetches w/o DMI, the ibus transactions issued for them and the delay the transactions added
+        uint64_t fetches{0}, transactions{0};
+        sc_core::sc_time delay;
+
+        bool hit(uint64_t addr, unsigned length) const { return addr >= start && addr + length - 1 <= end; }
+
+        bool overlaps(uint64_t s, uint64_t e) const { return start <= e && s <= end; }
+
+        void invalidate() {
+            start = 1;
+            end = 0;
+        }
+    } fetch_buf;
+    //! serves a fetch from the line buffer, refilling it if needed. Returns false if the fetch needs to be done as is
+    bool read_fetch_buffer(uint64_t addr, unsigned length, uint8_t* const data);
+    /**
+     * data announced by a unit-stride vector load, read with one dbus transaction when the first element needs a
+     * transaction. It is limited to the page of that element as the following pages may be mapped elsewhere
+     */
+    struct burst_buffer {
+        std::vector<uint8_t> data;
+        uint64_t start{1}, end{0};
+        //! the max. number of bytes the instruction still reads
+        uint64_t remaining{0};
+
+        bool hit(uint64_t addr, unsigned length) const { return addr >= start && addr + length - 1 <= end; }
+
+        bool overlaps(uint64_t s, uint64_t e) const { return start <= e && s <= end; }
+
+        void invalidate() {
+            start = 1;
+            end = 0;
+        }
+    } read_burst;
+    //! serves a data read from the burst buffer, filling it if needed. Returns false if the read needs to be done as is
+    bool read_from_burst(iss::addr_t const& addr, unsigned length, uint8_t* const data);
     std::vector<iss::vm_plugin*> plugin_list;
 };
 } // namespace riscv
@@ -33,8 +33,10 @@
 #ifndef _SYSC_CORE_COMPLEX__IF_H_
 #define _SYSC_CORE_COMPLEX__IF_H_
 
+#include <atomic>
 #include <iss/mem/clic.h>
 #include <iss/vm_types.h>
+#include <limits>
 #include <scc/signal_opt_ports.h>
 #include <util/delegate.h>
 
@@ -63,11 +65,27 @@ struct core_complex_if {
     //! Allow quantum keeper handling
     virtual void sync(uint64_t) = 0;
 
+    //! number of cycles until the next quantum keeper sync point, used to skip idle time
+    virtual uint64_t get_cycles_to_sync() { return 0; }
+
+    //! the max. number of contiguous bytes the following data reads of the instruction access, 0 ends the burst
+    virtual void set_read_burst(uint64_t bytes) {}
+
+    //! switches from the functional fast mode to the timed mode
+    virtual void end_fast_forward() {}
+
     util::delegate<void(std::function<void(void)>&)> exec_on_sysc;
 
     virtual char const* hier_name() = 0;
 
     scc::sc_in_opt<uint64_t> mtime_i{"mtime_i"};
+
+    //! functional fast mode: bus latencies are ignored, the triggers below are checked at the start of each instruction
+    bool ff_active{false};
+    //! instruction count ending the fast mode, set to 0 from any thread to end it at the next instruction
+    std::atomic<uint64_t> ff_icount{std::numeric_limits<uint64_t>::max()};
+    //! PC ending the fast mode
+    uint64_t ff_pc{std::numeric_limits<uint64_t>::max()};
 };
 } // namespace riscv
 } /* namespace sysc */
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "scv-tr/scv_tr.h"
+#include <chrono>
+#include <deque>
 #include <rigtorp/SPSCQueue.h>
+#include <scc/report.h>
 #include <scc/utilities.h>
+#include <unordered_map>
 #include <tlm/scc/quantum_keeper.h>
 #include <tlm/scc/scv/tlm_recording_extension.h>
 #ifdef HAS_SCV
@@ -20,6 +24,7 @@ namespace riscv {
 struct instr_recorder_b {
     bool init(std::string const& basename) {
         if(tx_db != nullptr) {
+            name = basename;
             stream_hnd = new SCVNS scv_tr_stream((basename + ".instr").c_str(), "TRANSACTOR", tx_db);
             gen_hndl = new SCVNS scv_tr_generator<>("execute", *stream_hnd);
             gen_timed_hndl = new SCVNS scv_tr_generator<>("execute(timed)", *stream_hnd);
@@ -29,7 +34,26 @@ struct instr_recorder_b {
     }
     instr_recorder_b(SCVNS scv_tr_db* tx_db = SCVNS scv_tr_db::get_default_db())
     : tx_db(tx_db) {}
+    /**
+     * marks the disassembly strings passed to disass_output as owned by the VM and kept alive until it is destroyed
+     * (as done by the disassembly cache of the interpreter) so they can be referenced instead of copied
+     */
+    void set_stable_disass(bool stable) { stable_disass = stable; }
+
+    //! true if the instructions are recorded, i.e. a transaction database was available at init()
+    bool is_recording() const { return stream_hnd != nullptr; }
+
+    ~instr_recorder_b() {
+        if(recorded > 1) {
+            auto const us = std::chrono::duration<double, std::micro>(last_record - first_record).count();
+            SCCINFO(name.c_str()) << "recorded " << recorded << " instructions at " << (us > 0 ? recorded / us : 0.0) << " MIPS";
+        }
+    }
+
     void record_instr(uint64_t pc, std::string const& instr_str, char mode, uint64_t status, sc_core::sc_time ltime) {
+        last_record = std::chrono::steady_clock::now();
+        if(!recorded++)
+            first_record = last_record;
         tx_hndl = gen_hndl->begin_transaction();
         tx_hndl.record_attribute("PC", pc);
         tx_hndl.record_attribute("INSTR", instr_str);
@@ -68,6 +92,11 @@ protected:
     SCVNS scv_tr_generator<SCVNS _scv_tr_generator_default_data, SCVNS _scv_tr_generator_default_data>* gen_timed_hndl{nullptr};
     SCVNS scv_tr_handle tx_hndl;
     SCVNS scv_tr_handle tx_timed_hndl;
+    //! statistics of the recording, used to report the achieved MIPS
+    std::string name;
+    uint64_t recorded{0};
+    std::chrono::steady_clock::time_point first_record, last_record;
+    bool stable_disass{false};
 };
 
 template <typename QK> struct instr_recorder : instr_recorder_b {};
@@ -86,21 +115,46 @@ protected:
 };
 #if SC_VERSION_MAJOR > 2
 template <> struct instr_recorder<tlm::scc::quantumkeeper_mt> : instr_recorder_b {
+    /**
+     * called by the ISS thread, it never blocks: records not fitting into the queue are kept back until there is space.
+     * Waiting for the SystemC thread could deadlock as it may wait for the ISS thread itself, so once max_kept_back
+     * records are pending further records are dropped
+     */
     void disass_output(uint64_t pc, std::string const& instr_str, char mode, uint64_t status) {
         if(stream_hnd == nullptr)
             return;
-        que.push(instr_record{pc, instr_str, mode, status, quantum_keeper.get_local_absolute_time()});
+        // once records are kept back the following ones need to queue up behind them to keep the order
+        while(!kept_back.empty() && que.try_push(kept_back.front()))
+            kept_back.pop_front();
+        if(kept_back.size() >= max_kept_back) {
+            dropped_cnt++;
+            return;
+        }
+        instr_record r{pc, intern(pc, instr_str), status, quantum_keeper.get_local_absolute_time(), mode};
+        if(kept_back.empty() && que.try_push(r))
+            return;
+        kept_back.push_back(r);
+        kept_back_cnt++;
     }
 
+    //! called by the SystemC thread
     void record() {
         while(auto r = que.front()) {
-            record_instr(r->pc, r->instr_str, r->mode, r->status, r->start_time);
+            record_instr(r->pc, *r->instr_str, r->mode, r->status, r->start_time);
             que.pop();
         }
     }
 
     struct callback : sc_core::sc_stage_callback_if {
-        void stage_callback(const sc_core::sc_stage& stage) override { owner->record(); }
+        void stage_callback(const sc_core::sc_stage& stage) override {
+            owner->record();
+            if(stage == sc_core::SC_POST_END_OF_SIMULATION) {
+                // the ISS thread has finished, so the records kept back can be taken over
+                for(auto& r : owner->kept_back)
+                    owner->record_instr(r.pc, *r.instr_str, r.mode, r.status, r.start_time);
+                owner->kept_back.clear();
+            }
+        }
         callback(instr_recorder<tlm::scc::quantumkeeper_mt>* owner)
         : owner(owner) {}
         instr_recorder<tlm::scc::quantumkeeper_mt>* owner;
@@ -109,19 +163,48 @@ template <> struct instr_recorder<tlm::scc::quantumkeeper_mt> : instr_recorder_b
     instr_recorder(tlm::scc::quantumkeeper_mt& quantum_keeper)
     : quantum_keeper(quantum_keeper)
     , que(8 * 1024) {
-        sc_core::sc_register_stage_callback(stage_cb, sc_core::SC_PRE_TIMESTEP);
+        sc_core::sc_register_stage_callback(stage_cb, sc_core::SC_PRE_TIMESTEP | sc_core::SC_POST_END_OF_SIMULATION);
+    }
+
+    ~instr_recorder() {
+        if(kept_back_cnt)
+            SCCINFO(name.c_str()) << kept_back_cnt << " instruction records were kept back as the queue was full";
+        if(dropped_cnt)
+            SCCWARN(name.c_str()) << dropped_cnt << " instruction records were dropped as the queue and the backlog were full";
     }
 
 protected:
+    //! fixed size record, the disassembly is shared by all records of the same code
     struct instr_record {
         uint64_t pc;
-        std::string const instr_str;
-        char mode;
+        std::string const* instr_str;
         uint64_t status;
         sc_core::sc_time start_time;
+        char mode;
     };
+    /**
+     * returns the cached disassembly of pc, a new string is only allocated for code not seen before or if the code at pc
+     * changed. The strings are never freed or modified while recording as the SystemC thread may still refer to them.
+     * Strings owned by the disassembly cache of the VM are referenced directly
+     */
+    std::string const* intern(uint64_t pc, std::string const& instr_str) {
+        if(stable_disass)
+            return &instr_str;
+        auto& entry = disass_cache[pc];
+        if(!entry || *entry != instr_str) {
+            disass_strings.emplace_back(instr_str);
+            entry = &disass_strings.back();
+        }
+        return entry;
+    }
     tlm::scc::quantumkeeper_mt& quantum_keeper;
     rigtorp::SPSCQueue<instr_record> que;
+    static constexpr size_t max_kept_back = 64 * 1024;
+    std::deque<instr_record> kept_back;
+    uint64_t kept_back_cnt{0};
+    uint64_t dropped_cnt{0};
+    std::unordered_map<uint64_t, std::string const*> disass_cache;
+    std::deque<std::string> disass_strings;
 };
 #endif
 } // namespace riscv
@@ -32,6 +32,7 @@
 
 // clang-format off
 #include <iss/arch/rv32gc.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -39,6 +40,7 @@
 #include <asmjit/asmjit.h>
 #include <util/logging.h>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 #include <fp_functions.h>
 
@@ -117,6 +119,12 @@ protected:
     continuation_e gen_single_inst_behavior(virt_addr_t&, jit_holder&) override;
     enum globals_e {TVAL = 0, GLOBALS_SIZE};
     void gen_block_prologue(jit_holder& jh) override;
+    static void idle_loop_head(void* hart, uint64_t head) { static_cast<arch::riscv_hart_if*>(hart)->idle_loop_head(head); }
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
+    void gen_count_instr(jit_holder& jh, code_word_t instr);
+    continuation_e gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f, jit_holder& jh);
+    bool block_start{false};
     void gen_block_epilogue(jit_holder& jh) override;
     inline const char *name(size_t index){return traits::reg_aliases.at(index);}
 
@@ -514,6 +522,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     /* instruction definitions */
     /* instruction 0: LUI */
     continuation_e __lui(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
@@ -521,14 +532,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -568,14 +582,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -615,14 +632,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -674,14 +694,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -745,14 +768,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -809,14 +835,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -873,14 +902,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -939,14 +971,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1005,14 +1040,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1069,14 +1107,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1133,14 +1174,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1186,14 +1230,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1239,14 +1286,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1292,14 +1342,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1344,14 +1397,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1396,14 +1452,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1444,14 +1503,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1492,14 +1554,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1540,14 +1605,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1589,14 +1657,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1649,14 +1720,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1709,14 +1783,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1757,14 +1834,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1805,14 +1885,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1853,14 +1936,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1901,14 +1987,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1949,14 +2038,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1997,14 +2089,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2046,14 +2141,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2095,14 +2193,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2143,14 +2244,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2203,14 +2307,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2263,14 +2370,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2311,14 +2421,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2359,14 +2472,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2408,14 +2524,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2456,14 +2575,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2506,14 +2628,17 @@ private:
         uint8_t pred = ((bit_sub<24,4>(instr)));
         uint8_t fm = ((bit_sub<28,4>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                    fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2543,13 +2668,16 @@ private:
     continuation_e __ecall(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ecall";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ecall";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2580,13 +2708,16 @@ private:
     continuation_e __ebreak(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ebreak";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ebreak";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2617,13 +2748,16 @@ private:
     continuation_e __mret(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "mret";
+                //No disass specified, using instruction name
+                std::string mnemonic = "mret";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2654,13 +2788,16 @@ private:
     continuation_e __wfi(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "wfi";
+                //No disass specified, using instruction name
+                std::string mnemonic = "wfi";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2695,14 +2832,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2749,14 +2889,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2802,14 +2945,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2855,14 +3001,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2905,14 +3054,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2957,14 +3109,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3009,14 +3164,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3049,14 +3207,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3099,14 +3260,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3149,14 +3313,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3199,14 +3366,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3249,14 +3419,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3333,14 +3506,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3399,14 +3575,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3486,14 +3665,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3553,14 +3735,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3607,14 +3792,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3682,14 +3870,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3738,14 +3929,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3796,14 +3990,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3852,14 +4049,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3908,14 +4108,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3964,14 +4167,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4033,14 +4239,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4102,14 +4311,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4170,14 +4382,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4235,14 +4450,17 @@ private:
         uint8_t rd = ((bit_sub<2,3>(instr)));
         uint16_t imm = ((bit_sub<5,1>(instr) << 3) | (bit_sub<6,1>(instr) << 2) | (bit_sub<7,4>(instr) << 6) | (bit_sub<11,2>(instr) << 4));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4282,14 +4500,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4327,14 +4548,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
-                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
+                    fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4369,14 +4593,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4416,13 +4643,16 @@ private:
         uint64_t PC = pc.val;
         uint8_t nzimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "c.nop";
+                //No disass specified, using instruction name
+                std::string mnemonic = "c.nop";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4452,14 +4682,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
-                fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
+                    fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4496,14 +4729,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4543,14 +4779,17 @@ private:
         uint32_t imm = ((bit_sub<2,5>(instr) << 12) | (bit_sub<12,1>(instr) << 17));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4587,14 +4826,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t nzimm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 7) | (bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 4) | (bit_sub<12,1>(instr) << 9));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
-                fmt::arg("nzimm", nzimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
+                    fmt::arg("nzimm", nzimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4632,13 +4874,16 @@ private:
         uint64_t PC = pc.val;
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = ".reserved_clui";
+                //No disass specified, using instruction name
+                std::string mnemonic = ".reserved_clui";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4670,14 +4915,17 @@ private:
         uint8_t shamt = ((bit_sub<2,5>(instr)));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4710,14 +4958,17 @@ private:
         uint8_t shamt = ((bit_sub<2,5>(instr)));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4762,14 +5013,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4803,14 +5057,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4844,14 +5101,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4884,14 +5144,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4924,14 +5187,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4963,14 +5229,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
-                fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
+                    fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5005,14 +5274,17 @@ private:
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5056,14 +5328,17 @@ private:
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5107,14 +5382,17 @@ private:
         uint8_t nzuimm = ((bit_sub<2,5>(instr)));
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5154,14 +5432,17 @@ private:
         uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, sp, {uimm:#05x}", fmt::arg("mnemonic", "c.lwsp"),
-                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, sp, {uimm:#05x}", fmt::arg("mnemonic", "c.lwsp"),
+                    fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5203,14 +5484,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5249,14 +5533,17 @@ private:
         uint64_t PC = pc.val;
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
-                fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
+                    fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5295,13 +5582,16 @@ private:
     continuation_e ____reserved_cmv(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = ".reserved_cmv";
+                //No disass specified, using instruction name
+                std::string mnemonic = ".reserved_cmv";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5333,14 +5623,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5380,14 +5673,17 @@ private:
         uint64_t PC = pc.val;
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
-                fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
+                    fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5429,13 +5725,16 @@ private:
     continuation_e __c__ebreak(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "c.ebreak";
+                //No disass specified, using instruction name
+                std::string mnemonic = "c.ebreak";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5467,14 +5766,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5512,13 +5814,16 @@ private:
     continuation_e __dii(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "dii";
+                //No disass specified, using instruction name
+                std::string mnemonic = "dii";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5551,14 +5856,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
-                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5606,14 +5914,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
-                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
+                    fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5655,14 +5966,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5740,14 +6054,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5825,14 +6142,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5910,14 +6230,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5994,14 +6317,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6071,14 +6397,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6148,14 +6477,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6225,14 +6557,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6321,14 +6656,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6417,14 +6755,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6513,14 +6854,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6607,14 +6951,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6686,14 +7033,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6765,14 +7115,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6839,14 +7192,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6913,14 +7269,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6976,14 +7335,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7039,14 +7401,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7100,14 +7465,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7150,14 +7518,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7204,14 +7575,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7282,14 +7656,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7360,14 +7737,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7437,14 +7817,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7499,14 +7882,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.flw"),
-                fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.flw"),
+                    fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7551,14 +7937,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsw"),
-                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsw"),
+                    fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7593,14 +7982,17 @@ private:
         uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.flwsp"),
-                fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.flwsp"),
+                    fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7644,14 +8036,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fswsp"),
-                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fswsp"),
+                    fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7687,14 +8082,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
-                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7742,14 +8140,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
-                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
+                    fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7791,14 +8192,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7876,14 +8280,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7961,14 +8368,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8046,14 +8456,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8130,14 +8543,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8207,14 +8623,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8284,14 +8703,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8361,14 +8783,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8457,14 +8882,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8554,14 +8982,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8650,14 +9081,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8744,14 +9178,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8823,14 +9260,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8902,14 +9342,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8976,14 +9419,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9050,14 +9496,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9125,14 +9574,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9194,14 +9646,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9257,14 +9712,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9320,14 +9778,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9382,14 +9843,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9461,14 +9925,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9540,14 +10007,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9618,14 +10088,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9681,14 +10154,17 @@ private:
         uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
-                fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
+                    fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9733,14 +10209,17 @@ private:
         uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
-                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
+                    fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9775,14 +10254,17 @@ private:
         uint16_t uimm = ((bit_sub<2,3>(instr) << 6) | (bit_sub<5,2>(instr) << 3) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
-                fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
+                    fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9826,14 +10308,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint16_t uimm = ((bit_sub<7,3>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
-                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
+                    fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9868,14 +10353,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t asid = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9905,13 +10393,16 @@ private:
     continuation_e __sret(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "sret";
+                //No disass specified, using instruction name
+                std::string mnemonic = "sret";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9944,10 +10435,9 @@ private:
     continuation_e illegal_instruction(virt_addr_t &pc, code_word_t instr, jit_holder& jh ) {
         x86::Compiler& cc = jh.cc;
         if(this->disass_enabled){          
-            auto mnemonic = std::string("illegal_instruction");
+            auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("illegal_instruction"); });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9980,7 +10470,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
         }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 template <typename ARCH>
 continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_holder& jh) {
@@ -9992,13 +10486,123 @@ continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_hold
         return ILLEGAL_FETCH;
     if (instr == 0x0000006f || (instr&0xffff)==0xa001)
         return JUMP_TO_SELF;
+    if(block_start) {
+        block_start = false;
+        // a block starting an idle loop reports each iteration to the hart
+        if(idle_if && idle_if->idle_loop_detection() && idle_if->is_idle_loop(pc.val)) {
+            InvokeNode* call_idle_loop_head;
+            jh.cc.invoke(&call_idle_loop_head, &idle_loop_head, FuncSignature::build<void, void*, uint64_t>());
+            call_idle_loop_head->setArg(0, static_cast<void*>(idle_if));
+            call_idle_loop_head->setArg(1, pc.val);
+        }
+    }
     uint32_t inst_index = instr_decoder.decode_instr(instr);
     compile_func f = nullptr;
     if(inst_index < instr_descr.size())
         f = instr_descr[inst_index].op;
     if (f == nullptr) 
         f = &this_class::illegal_instruction;
-    return (this->*f)(pc, instr, jh);
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    auto cont = is_csr_read && f != &this_class::illegal_instruction ? gen_inline_csr_read(pc, instr, inst_index, f, jh)
+                                                                      : (this->*f)(pc, instr, jh);
+    if(hpm && hpm->instr_active)
+        gen_count_instr(jh, instr);
+    // the selected events are compiled into the code, so it needs to be retranslated if mhpmevent or mcountinhibit are
+    // written. csrrs/csrrc with x0 and the immediate variants with 0 only read the CSR
+    auto const csr = instr >> 20;
+    if(cont == CONT && (instr & 0x7f) == 0x73 && (instr & 0x3000) && !is_csr_read && csr >= 0x320 && csr < 0x340)
+        return FLUSH;
+    return cont;
+}
+template <typename ARCH>
+continuation_e vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f,
+                                                  jit_holder& jh) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = idle_if ? idle_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, jh);
+    auto& cc = jh.cc;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    auto const req_priv = (csr >> 8) & 0x3;
+    Label label_slow, label_done;
+    if(req_priv) {
+        label_slow = cc.newLabel();
+        label_done = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::PRIV), req_priv);
+        cc.jb(label_slow);
+    }
+    cc.comment(fmt::format("CSR_READ_{:#x}:", pc.val).c_str());
+    gen_sync(jh, PRE_SYNC, inst_index);
+    mov(cc, jh.pc, pc.val);
+    gen_set_tval(jh, instr);
+    mov(cc, jh.next_pc, pc.val + 4);
+    cc.mov(get_ptr_for(jh, traits::INSTRUCTION), instr);
+    gen_instr_prologue(jh);
+    auto value = get_reg_Gp(cc, 64, false);
+    auto tmp = get_reg_Gp(cc, 64, false);
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN:
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.ptr));
+        if(traits::XLEN == 32)
+            cc.mov(value.r32(), x86::dword_ptr(tmp));
+        else
+            cc.mov(value, x86::qword_ptr(tmp));
+        break;
+    case arch::csr_inline_read::CYCLE:
+        cc.mov(value, get_ptr_for(jh, traits::CYCLE));
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.offset));
+        cc.add(value, x86::qword_ptr(tmp));
+        if(descr.divider > 1) {
+            auto hi = get_reg_Gp(cc, 64, false);
+            cc.xor_(hi, hi);
+            cc.mov(tmp, descr.divider);
+            cc.div(hi, value, tmp);
+        }
+        break;
+    default:
+        cc.mov(value, get_ptr_for(jh, traits::INSTRET));
+        break;
+    }
+    if(descr.shift)
+        cc.shr(value, descr.shift);
+    if(rd != 0) {
+        if(traits::XLEN == 32)
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value.r32());
+        else
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value);
+    }
+    gen_sync(jh, POST_SYNC, inst_index);
+    gen_instr_epilogue(jh);
+    if(!req_priv) {
+        pc = pc + 4;
+        return CONT;
+    }
+    cc.jmp(label_done);
+    cc.bind(label_slow);
+    auto cont = (this->*f)(pc, instr, jh);
+    cc.bind(label_done);
+    return cont;
+}
+template <typename ARCH>
+void vm_impl<ARCH>::gen_count_instr(jit_holder& jh, code_word_t instr) {
+    auto& cc = jh.cc;
+    auto const evt = arch::hpm_counters::classify<traits::XLEN>(instr);
+    if(!(hpm->active & (1ULL << evt)))
+        return;
+    cc.comment("//count hpm event");
+    auto counter = get_reg_Gp(cc, 64, false);
+    cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[evt]));
+    cc.inc(x86::qword_ptr(counter));
+    if(evt == arch::HPM_BRANCH && (hpm->active & (1ULL << arch::HPM_BRANCH_TAKEN))) {
+        auto label_not_taken = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::LAST_BRANCH), static_cast<int>(NO_JUMP));
+        cc.je(label_not_taken);
+        cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[arch::HPM_BRANCH_TAKEN]));
+        cc.inc(x86::qword_ptr(counter));
+        cc.bind(label_not_taken);
+    }
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_instr_prologue(jit_holder& jh) {
@@ -10027,6 +10631,7 @@ void vm_impl<ARCH>::gen_instr_epilogue(jit_holder& jh) {
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_block_prologue(jit_holder& jh){
+    block_start = true;
     jh.pc = load_reg_from_mem_Gp(jh, traits::PC);
     jh.next_pc = load_reg_from_mem_Gp(jh, traits::NEXT_PC);
     jh.globals.resize(GLOBALS_SIZE);
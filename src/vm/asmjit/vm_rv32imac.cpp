@@ -32,6 +32,7 @@
 
 // clang-format off
 #include <iss/arch/rv32imac.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -39,6 +40,7 @@
 #include <asmjit/asmjit.h>
 #include <util/logging.h>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 
 #ifndef FMT_HEADER_ONLY
@@ -115,6 +117,12 @@ protected:
     continuation_e gen_single_inst_behavior(virt_addr_t&, jit_holder&) override;
     enum globals_e {TVAL = 0, GLOBALS_SIZE};
     void gen_block_prologue(jit_holder& jh) override;
+    static void idle_loop_head(void* hart, uint64_t head) { static_cast<arch::riscv_hart_if*>(hart)->idle_loop_head(head); }
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
+    void gen_count_instr(jit_holder& jh, code_word_t instr);
+    continuation_e gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f, jit_holder& jh);
+    bool block_start{false};
     void gen_block_epilogue(jit_holder& jh) override;
     inline const char *name(size_t index){return traits::reg_aliases.at(index);}
 
@@ -351,6 +359,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     /* instruction definitions */
     /* instruction 0: LUI */
     continuation_e __lui(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
@@ -358,14 +369,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -405,14 +419,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -452,14 +469,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -511,14 +531,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -582,14 +605,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -646,14 +672,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -710,14 +739,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -776,14 +808,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -842,14 +877,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -906,14 +944,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -970,14 +1011,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1023,14 +1067,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1076,14 +1123,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1129,14 +1179,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1181,14 +1234,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1233,14 +1289,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1281,14 +1340,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1329,14 +1391,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1377,14 +1442,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1426,14 +1494,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1486,14 +1557,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1546,14 +1620,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1594,14 +1671,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1642,14 +1722,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1690,14 +1773,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1738,14 +1824,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1786,14 +1875,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1834,14 +1926,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1883,14 +1978,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1932,14 +2030,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1980,14 +2081,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2040,14 +2144,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2100,14 +2207,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2148,14 +2258,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2196,14 +2309,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2245,14 +2361,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2293,14 +2412,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2343,14 +2465,17 @@ private:
         uint8_t pred = ((bit_sub<24,4>(instr)));
         uint8_t fm = ((bit_sub<28,4>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                    fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2380,13 +2505,16 @@ private:
     continuation_e __ecall(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ecall";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ecall";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2417,13 +2545,16 @@ private:
     continuation_e __ebreak(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ebreak";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ebreak";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2454,13 +2585,16 @@ private:
     continuation_e __mret(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "mret";
+                //No disass specified, using instruction name
+                std::string mnemonic = "mret";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2491,13 +2625,16 @@ private:
     continuation_e __wfi(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "wfi";
+                //No disass specified, using instruction name
+                std::string mnemonic = "wfi";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2532,14 +2669,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2586,14 +2726,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2639,14 +2782,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2692,14 +2838,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2742,14 +2891,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2794,14 +2946,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2846,14 +3001,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2886,14 +3044,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2936,14 +3097,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2986,14 +3150,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3036,14 +3203,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3086,14 +3256,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3170,14 +3343,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3236,14 +3412,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3323,14 +3502,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3390,14 +3572,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3444,14 +3629,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3519,14 +3707,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3575,14 +3766,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3633,14 +3827,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3689,14 +3886,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3745,14 +3945,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3801,14 +4004,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3870,14 +4076,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3939,14 +4148,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4007,14 +4219,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4072,14 +4287,17 @@ private:
         uint8_t rd = ((bit_sub<2,3>(instr)));
         uint16_t imm = ((bit_sub<5,1>(instr) << 3) | (bit_sub<6,1>(instr) << 2) | (bit_sub<7,4>(instr) << 6) | (bit_sub<11,2>(instr) << 4));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4119,14 +4337,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4164,14 +4385,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
-                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
+                    fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4206,14 +4430,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4253,13 +4480,16 @@ private:
         uint64_t PC = pc.val;
         uint8_t nzimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "c.nop";
+                //No disass specified, using instruction name
+                std::string mnemonic = "c.nop";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4289,14 +4519,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
-                fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
+                    fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4333,14 +4566,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4380,14 +4616,17 @@ private:
         uint32_t imm = ((bit_sub<2,5>(instr) << 12) | (bit_sub<12,1>(instr) << 17));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4424,14 +4663,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t nzimm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 7) | (bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 4) | (bit_sub<12,1>(instr) << 9));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
-                fmt::arg("nzimm", nzimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
+                    fmt::arg("nzimm", nzimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4469,13 +4711,16 @@ private:
         uint64_t PC = pc.val;
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = ".reserved_clui";
+                //No disass specified, using instruction name
+                std::string mnemonic = ".reserved_clui";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4507,14 +4752,17 @@ private:
         uint8_t shamt = ((bit_sub<2,5>(instr)));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4547,14 +4795,17 @@ private:
         uint8_t shamt = ((bit_sub<2,5>(instr)));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4599,14 +4850,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4640,14 +4894,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4681,14 +4938,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4721,14 +4981,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4761,14 +5024,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4800,14 +5066,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
-                fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
+                    fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4842,14 +5111,17 @@ private:
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4893,14 +5165,17 @@ private:
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4944,14 +5219,17 @@ private:
         uint8_t nzuimm = ((bit_sub<2,5>(instr)));
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4991,14 +5269,17 @@ private:
         uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, sp, {uimm:#05x}", fmt::arg("mnemonic", "c.lwsp"),
-                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, sp, {uimm:#05x}", fmt::arg("mnemonic", "c.lwsp"),
+                    fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5040,14 +5321,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5086,14 +5370,17 @@ private:
         uint64_t PC = pc.val;
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
-                fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
+                    fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5132,13 +5419,16 @@ private:
     continuation_e ____reserved_cmv(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = ".reserved_cmv";
+                //No disass specified, using instruction name
+                std::string mnemonic = ".reserved_cmv";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5170,14 +5460,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5217,14 +5510,17 @@ private:
         uint64_t PC = pc.val;
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
-                fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
+                    fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5266,13 +5562,16 @@ private:
     continuation_e __c__ebreak(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "c.ebreak";
+                //No disass specified, using instruction name
+                std::string mnemonic = "c.ebreak";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5304,14 +5603,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5349,13 +5651,16 @@ private:
     continuation_e __dii(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "dii";
+                //No disass specified, using instruction name
+                std::string mnemonic = "dii";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5387,10 +5692,9 @@ private:
     continuation_e illegal_instruction(virt_addr_t &pc, code_word_t instr, jit_holder& jh ) {
         x86::Compiler& cc = jh.cc;
         if(this->disass_enabled){          
-            auto mnemonic = std::string("illegal_instruction");
+            auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("illegal_instruction"); });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5423,7 +5727,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
         }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 template <typename ARCH>
 continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_holder& jh) {
@@ -5435,13 +5743,123 @@ continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_hold
         return ILLEGAL_FETCH;
     if (instr == 0x0000006f || (instr&0xffff)==0xa001)
         return JUMP_TO_SELF;
+    if(block_start) {
+        block_start = false;
+        // a block starting an idle loop reports each iteration to the hart
+        if(idle_if && idle_if->idle_loop_detection() && idle_if->is_idle_loop(pc.val)) {
+            InvokeNode* call_idle_loop_head;
+            jh.cc.invoke(&call_idle_loop_head, &idle_loop_head, FuncSignature::build<void, void*, uint64_t>());
+            call_idle_loop_head->setArg(0, static_cast<void*>(idle_if));
+            call_idle_loop_head->setArg(1, pc.val);
+        }
+    }
     uint32_t inst_index = instr_decoder.decode_instr(instr);
     compile_func f = nullptr;
     if(inst_index < instr_descr.size())
         f = instr_descr[inst_index].op;
     if (f == nullptr) 
         f = &this_class::illegal_instruction;
-    return (this->*f)(pc, instr, jh);
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    auto cont = is_csr_read && f != &this_class::illegal_instruction ? gen_inline_csr_read(pc, instr, inst_index, f, jh)
+                                                                      : (this->*f)(pc, instr, jh);
+    if(hpm && hpm->instr_active)
+        gen_count_instr(jh, instr);
+    // the selected events are compiled into the code, so it needs to be retranslated if mhpmevent or mcountinhibit are
+    // written. csrrs/csrrc with x0 and the immediate variants with 0 only read the CSR
+    auto const csr = instr >> 20;
+    if(cont == CONT && (instr & 0x7f) == 0x73 && (instr & 0x3000) && !is_csr_read && csr >= 0x320 && csr < 0x340)
+        return FLUSH;
+    return cont;
+}
+template <typename ARCH>
+continuation_e vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f,
+                                                  jit_holder& jh) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = idle_if ? idle_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, jh);
+    auto& cc = jh.cc;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    auto const req_priv = (csr >> 8) & 0x3;
+    Label label_slow, label_done;
+    if(req_priv) {
+        label_slow = cc.newLabel();
+        label_done = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::PRIV), req_priv);
+        cc.jb(label_slow);
+    }
+    cc.comment(fmt::format("CSR_READ_{:#x}:", pc.val).c_str());
+    gen_sync(jh, PRE_SYNC, inst_index);
+    mov(cc, jh.pc, pc.val);
+    gen_set_tval(jh, instr);
+    mov(cc, jh.next_pc, pc.val + 4);
+    cc.mov(get_ptr_for(jh, traits::INSTRUCTION), instr);
+    gen_instr_prologue(jh);
+    auto value = get_reg_Gp(cc, 64, false);
+    auto tmp = get_reg_Gp(cc, 64, false);
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN:
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.ptr));
+        if(traits::XLEN == 32)
+            cc.mov(value.r32(), x86::dword_ptr(tmp));
+        else
+            cc.mov(value, x86::qword_ptr(tmp));
+        break;
+    case arch::csr_inline_read::CYCLE:
+        cc.mov(value, get_ptr_for(jh, traits::CYCLE));
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.offset));
+        cc.add(value, x86::qword_ptr(tmp));
+        if(descr.divider > 1) {
+            auto hi = get_reg_Gp(cc, 64, false);
+            cc.xor_(hi, hi);
+            cc.mov(tmp, descr.divider);
+            cc.div(hi, value, tmp);
+        }
+        break;
+    default:
+        cc.mov(value, get_ptr_for(jh, traits::INSTRET));
+        break;
+    }
+    if(descr.shift)
+        cc.shr(value, descr.shift);
+    if(rd != 0) {
+        if(traits::XLEN == 32)
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value.r32());
+        else
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value);
+    }
+    gen_sync(jh, POST_SYNC, inst_index);
+    gen_instr_epilogue(jh);
+    if(!req_priv) {
+        pc = pc + 4;
+        return CONT;
+    }
+    cc.jmp(label_done);
+    cc.bind(label_slow);
+    auto cont = (this->*f)(pc, instr, jh);
+    cc.bind(label_done);
+    return cont;
+}
+template <typename ARCH>
+void vm_impl<ARCH>::gen_count_instr(jit_holder& jh, code_word_t instr) {
+    auto& cc = jh.cc;
+    auto const evt = arch::hpm_counters::classify<traits::XLEN>(instr);
+    if(!(hpm->active & (1ULL << evt)))
+        return;
+    cc.comment("//count hpm event");
+    auto counter = get_reg_Gp(cc, 64, false);
+    cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[evt]));
+    cc.inc(x86::qword_ptr(counter));
+    if(evt == arch::HPM_BRANCH && (hpm->active & (1ULL << arch::HPM_BRANCH_TAKEN))) {
+        auto label_not_taken = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::LAST_BRANCH), static_cast<int>(NO_JUMP));
+        cc.je(label_not_taken);
+        cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[arch::HPM_BRANCH_TAKEN]));
+        cc.inc(x86::qword_ptr(counter));
+        cc.bind(label_not_taken);
+    }
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_instr_prologue(jit_holder& jh) {
@@ -5470,6 +5888,7 @@ void vm_impl<ARCH>::gen_instr_epilogue(jit_holder& jh) {
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_block_prologue(jit_holder& jh){
+    block_start = true;
     jh.pc = load_reg_from_mem_Gp(jh, traits::PC);
     jh.next_pc = load_reg_from_mem_Gp(jh, traits::NEXT_PC);
     jh.globals.resize(GLOBALS_SIZE);
@@ -32,6 +32,7 @@
 
 // clang-format off
 #include <iss/arch/rv64gc.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -39,6 +40,7 @@
 #include <asmjit/asmjit.h>
 #include <util/logging.h>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 #include <fp_functions.h>
 
@@ -117,6 +119,12 @@ protected:
     continuation_e gen_single_inst_behavior(virt_addr_t&, jit_holder&) override;
     enum globals_e {TVAL = 0, GLOBALS_SIZE};
     void gen_block_prologue(jit_holder& jh) override;
+    static void idle_loop_head(void* hart, uint64_t head) { static_cast<arch::riscv_hart_if*>(hart)->idle_loop_head(head); }
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
+    void gen_count_instr(jit_holder& jh, code_word_t instr);
+    continuation_e gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f, jit_holder& jh);
+    bool block_start{false};
     void gen_block_epilogue(jit_holder& jh) override;
     inline const char *name(size_t index){return traits::reg_aliases.at(index);}
 
@@ -594,6 +602,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     /* instruction definitions */
     /* instruction 0: LUI */
     continuation_e __lui(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
@@ -601,14 +612,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -650,14 +664,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -699,14 +716,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -760,14 +780,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -833,14 +856,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -897,14 +923,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -961,14 +990,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1027,14 +1059,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1093,14 +1128,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1157,14 +1195,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1221,14 +1262,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1274,14 +1318,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1327,14 +1374,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1380,14 +1430,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1432,14 +1485,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1484,14 +1540,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1532,14 +1591,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1580,14 +1642,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1628,14 +1693,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1677,14 +1745,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1737,14 +1808,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1797,14 +1871,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1845,14 +1922,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1893,14 +1973,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1941,14 +2024,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,6>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1989,14 +2075,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,6>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2037,14 +2126,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,6>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2087,14 +2179,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2136,14 +2231,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2185,14 +2283,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2233,14 +2334,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2293,14 +2397,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2353,14 +2460,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2401,14 +2511,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2449,14 +2562,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2498,14 +2614,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2546,14 +2665,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2596,14 +2718,17 @@ private:
         uint8_t pred = ((bit_sub<24,4>(instr)));
         uint8_t fm = ((bit_sub<28,4>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                    fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2633,13 +2758,16 @@ private:
     continuation_e __ecall(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ecall";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ecall";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2670,13 +2798,16 @@ private:
     continuation_e __ebreak(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ebreak";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ebreak";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2707,13 +2838,16 @@ private:
     continuation_e __mret(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "mret";
+                //No disass specified, using instruction name
+                std::string mnemonic = "mret";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2744,13 +2878,16 @@ private:
     continuation_e __wfi(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "wfi";
+                //No disass specified, using instruction name
+                std::string mnemonic = "wfi";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2785,14 +2922,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lwu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lwu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2838,14 +2978,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "ld"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "ld"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2891,14 +3034,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sd"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sd"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2939,14 +3085,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addiw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addiw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2990,14 +3139,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slliw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slliw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3041,14 +3193,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srliw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srliw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3092,14 +3247,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "sraiw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "sraiw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3143,13 +3301,16 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "addw";
+                //No disass specified, using instruction name
+                std::string mnemonic = "addw";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3195,13 +3356,16 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "subw";
+                //No disass specified, using instruction name
+                std::string mnemonic = "subw";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3247,14 +3411,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sllw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sllw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3300,14 +3467,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srlw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srlw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3353,14 +3523,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sraw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sraw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3406,14 +3579,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3460,14 +3636,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3513,14 +3692,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3566,14 +3748,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3616,14 +3801,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3668,14 +3856,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3720,14 +3911,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3760,14 +3954,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3810,14 +4007,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3860,14 +4060,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3910,14 +4113,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3960,14 +4166,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4048,14 +4257,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4116,14 +4328,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4204,14 +4419,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4270,14 +4488,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4323,14 +4544,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4417,14 +4641,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4491,14 +4718,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4586,14 +4816,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4662,14 +4895,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4716,14 +4952,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4791,14 +5030,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4847,14 +5089,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4905,14 +5150,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -4961,14 +5209,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5017,14 +5268,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5073,14 +5327,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5142,14 +5399,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5211,14 +5471,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5279,14 +5542,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5346,14 +5612,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "lrd"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "lrd"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5400,14 +5669,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "scd"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "scd"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5474,14 +5746,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapd"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapd"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5530,14 +5805,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddd"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddd"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5586,14 +5864,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxord"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxord"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5641,14 +5922,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandd"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandd"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5696,14 +5980,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoord"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoord"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5751,14 +6038,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomind"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomind"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5820,14 +6110,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxd"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxd"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5889,14 +6182,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominud"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominud"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -5955,14 +6251,17 @@ private:
         uint8_t rl = ((bit_sub<25,1>(instr)));
         uint8_t aq = ((bit_sub<26,1>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxud"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxud"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6019,14 +6318,17 @@ private:
         uint8_t rd = ((bit_sub<2,3>(instr)));
         uint16_t imm = ((bit_sub<5,1>(instr) << 3) | (bit_sub<6,1>(instr) << 2) | (bit_sub<7,4>(instr) << 6) | (bit_sub<11,2>(instr) << 4));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6066,14 +6368,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6111,14 +6416,17 @@ private:
         uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {uimm},({rs1})", fmt::arg("mnemonic", "c.ld"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {uimm},({rs1})", fmt::arg("mnemonic", "c.ld"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6155,14 +6463,17 @@ private:
         uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
-                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
+                    fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6198,14 +6509,17 @@ private:
         uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm},({rs1})", fmt::arg("mnemonic", "c.sd"),
-                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm},({rs1})", fmt::arg("mnemonic", "c.sd"),
+                    fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6239,14 +6553,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6286,13 +6603,16 @@ private:
         uint64_t PC = pc.val;
         uint8_t nzimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "c.nop";
+                //No disass specified, using instruction name
+                std::string mnemonic = "c.nop";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6323,14 +6643,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addiw"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addiw"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6374,14 +6697,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6423,14 +6749,17 @@ private:
         uint32_t imm = ((bit_sub<2,5>(instr) << 12) | (bit_sub<12,1>(instr) << 17));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6469,14 +6798,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t nzimm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 7) | (bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 4) | (bit_sub<12,1>(instr) << 9));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
-                fmt::arg("nzimm", nzimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
+                    fmt::arg("nzimm", nzimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6514,13 +6846,16 @@ private:
         uint64_t PC = pc.val;
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = ".reserved_clui";
+                //No disass specified, using instruction name
+                std::string mnemonic = ".reserved_clui";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6552,14 +6887,17 @@ private:
         uint8_t nzuimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.srli"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("nzuimm", nzuimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.srli"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("nzuimm", nzuimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6592,14 +6930,17 @@ private:
         uint8_t shamt = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6634,14 +6975,17 @@ private:
         uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6675,14 +7019,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6716,14 +7063,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6756,14 +7106,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6796,14 +7149,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6836,14 +7192,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.subw"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.subw"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6881,14 +7240,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,3>(instr)));
         uint8_t rd = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.addw"),
-                fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.addw"),
+                    fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6925,14 +7287,17 @@ private:
         uint64_t PC = pc.val;
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
-                fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
+                    fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -6967,14 +7332,17 @@ private:
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7018,14 +7386,17 @@ private:
         uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
-                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
+                    fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7069,14 +7440,17 @@ private:
         uint8_t shamt = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.slli"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.slli"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7116,14 +7490,17 @@ private:
         uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, sp, {uimm:#05x}", fmt::arg("mnemonic", "c.lwsp"),
-                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, sp, {uimm:#05x}", fmt::arg("mnemonic", "c.lwsp"),
+                    fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7165,14 +7542,17 @@ private:
         uint16_t uimm = ((bit_sub<2,3>(instr) << 6) | (bit_sub<5,2>(instr) << 3) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {uimm}(sp)", fmt::arg("mnemonic", "c.ldsp"),
-                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {uimm}(sp)", fmt::arg("mnemonic", "c.ldsp"),
+                    fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7214,14 +7594,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7260,14 +7643,17 @@ private:
         uint64_t PC = pc.val;
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
-                fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
+                    fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7306,13 +7692,16 @@ private:
     continuation_e ____reserved_cmv(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = ".reserved_cmv";
+                //No disass specified, using instruction name
+                std::string mnemonic = ".reserved_cmv";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7344,14 +7733,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7391,14 +7783,17 @@ private:
         uint64_t PC = pc.val;
         uint8_t rs1 = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
-                fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
+                    fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7442,13 +7837,16 @@ private:
     continuation_e __c__ebreak(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "c.ebreak";
+                //No disass specified, using instruction name
+                std::string mnemonic = "c.ebreak";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7480,14 +7878,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7527,14 +7928,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint16_t uimm = ((bit_sub<7,3>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {uimm}(sp)", fmt::arg("mnemonic", "c.sdsp"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {uimm}(sp)", fmt::arg("mnemonic", "c.sdsp"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7572,13 +7976,16 @@ private:
     continuation_e __dii(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "dii";
+                //No disass specified, using instruction name
+                std::string mnemonic = "dii";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7611,14 +8018,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
-                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7666,14 +8076,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
-                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
+                    fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7715,14 +8128,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7800,14 +8216,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7885,14 +8304,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -7970,14 +8392,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8054,14 +8479,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8131,14 +8559,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8208,14 +8639,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8285,14 +8719,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8381,14 +8818,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8477,14 +8917,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8573,14 +9016,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8667,14 +9113,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8746,14 +9195,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8825,14 +9277,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8904,14 +9359,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -8980,14 +9438,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9054,14 +9515,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9128,14 +9592,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.l"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.l"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9201,14 +9668,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.lu"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.lu"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9274,14 +9744,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9337,14 +9810,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9400,14 +9876,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9461,14 +9940,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9511,14 +9993,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9565,14 +10050,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9644,14 +10132,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9723,14 +10214,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9801,14 +10295,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9864,14 +10361,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
-                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9919,14 +10419,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
-                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
+                    fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -9968,14 +10471,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10053,14 +10559,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10138,14 +10647,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10223,14 +10735,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10307,14 +10822,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10384,14 +10902,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10461,14 +10982,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10538,14 +11062,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10634,14 +11161,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10731,14 +11261,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10827,14 +11360,17 @@ private:
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         uint8_t rs3 = ((bit_sub<27,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -10921,14 +11457,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11000,14 +11539,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11079,14 +11621,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11158,14 +11703,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11234,14 +11782,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11308,14 +11859,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11382,14 +11936,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.l"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.l"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11455,14 +12012,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.lu"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.lu"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11528,14 +12088,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11603,14 +12166,17 @@ private:
         uint8_t rm = ((bit_sub<12,3>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11672,14 +12238,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11735,14 +12304,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11798,14 +12370,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11859,14 +12434,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11909,14 +12487,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.d.x"),
-                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.d.x"),
+                    fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -11963,14 +12544,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12042,14 +12626,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12121,14 +12708,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12199,14 +12789,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12262,14 +12855,17 @@ private:
         uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
-                fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
+                    fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12314,14 +12910,17 @@ private:
         uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         uint8_t rs1 = ((bit_sub<7,3>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
-                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
+                    fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12356,14 +12955,17 @@ private:
         uint16_t uimm = ((bit_sub<2,3>(instr) << 6) | (bit_sub<5,2>(instr) << 3) | (bit_sub<12,1>(instr) << 5));
         uint8_t rd = ((bit_sub<7,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
-                fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
+                    fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12407,14 +13009,17 @@ private:
         uint8_t rs2 = ((bit_sub<2,5>(instr)));
         uint16_t uimm = ((bit_sub<7,3>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
-                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
+                    fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12449,14 +13054,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t asid = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12486,13 +13094,16 @@ private:
     continuation_e __sret(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "sret";
+                //No disass specified, using instruction name
+                std::string mnemonic = "sret";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12525,10 +13136,9 @@ private:
     continuation_e illegal_instruction(virt_addr_t &pc, code_word_t instr, jit_holder& jh ) {
         x86::Compiler& cc = jh.cc;
         if(this->disass_enabled){          
-            auto mnemonic = std::string("illegal_instruction");
+            auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("illegal_instruction"); });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -12561,7 +13171,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
         }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 template <typename ARCH>
 continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_holder& jh) {
@@ -12573,13 +13187,123 @@ continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_hold
         return ILLEGAL_FETCH;
     if (instr == 0x0000006f || (instr&0xffff)==0xa001)
         return JUMP_TO_SELF;
+    if(block_start) {
+        block_start = false;
+        // a block starting an idle loop reports each iteration to the hart
+        if(idle_if && idle_if->idle_loop_detection() && idle_if->is_idle_loop(pc.val)) {
+            InvokeNode* call_idle_loop_head;
+            jh.cc.invoke(&call_idle_loop_head, &idle_loop_head, FuncSignature::build<void, void*, uint64_t>());
+            call_idle_loop_head->setArg(0, static_cast<void*>(idle_if));
+            call_idle_loop_head->setArg(1, pc.val);
+        }
+    }
     uint32_t inst_index = instr_decoder.decode_instr(instr);
     compile_func f = nullptr;
     if(inst_index < instr_descr.size())
         f = instr_descr[inst_index].op;
     if (f == nullptr) 
         f = &this_class::illegal_instruction;
-    return (this->*f)(pc, instr, jh);
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    auto cont = is_csr_read && f != &this_class::illegal_instruction ? gen_inline_csr_read(pc, instr, inst_index, f, jh)
+                                                                      : (this->*f)(pc, instr, jh);
+    if(hpm && hpm->instr_active)
+        gen_count_instr(jh, instr);
+    // the selected events are compiled into the code, so it needs to be retranslated if mhpmevent or mcountinhibit are
+    // written. csrrs/csrrc with x0 and the immediate variants with 0 only read the CSR
+    auto const csr = instr >> 20;
+    if(cont == CONT && (instr & 0x7f) == 0x73 && (instr & 0x3000) && !is_csr_read && csr >= 0x320 && csr < 0x340)
+        return FLUSH;
+    return cont;
+}
+template <typename ARCH>
+continuation_e vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f,
+                                                  jit_holder& jh) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = idle_if ? idle_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, jh);
+    auto& cc = jh.cc;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    auto const req_priv = (csr >> 8) & 0x3;
+    Label label_slow, label_done;
+    if(req_priv) {
+        label_slow = cc.newLabel();
+        label_done = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::PRIV), req_priv);
+        cc.jb(label_slow);
+    }
+    cc.comment(fmt::format("CSR_READ_{:#x}:", pc.val).c_str());
+    gen_sync(jh, PRE_SYNC, inst_index);
+    mov(cc, jh.pc, pc.val);
+    gen_set_tval(jh, instr);
+    mov(cc, jh.next_pc, pc.val + 4);
+    cc.mov(get_ptr_for(jh, traits::INSTRUCTION), instr);
+    gen_instr_prologue(jh);
+    auto value = get_reg_Gp(cc, 64, false);
+    auto tmp = get_reg_Gp(cc, 64, false);
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN:
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.ptr));
+        if(traits::XLEN == 32)
+            cc.mov(value.r32(), x86::dword_ptr(tmp));
+        else
+            cc.mov(value, x86::qword_ptr(tmp));
+        break;
+    case arch::csr_inline_read::CYCLE:
+        cc.mov(value, get_ptr_for(jh, traits::CYCLE));
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.offset));
+        cc.add(value, x86::qword_ptr(tmp));
+        if(descr.divider > 1) {
+            auto hi = get_reg_Gp(cc, 64, false);
+            cc.xor_(hi, hi);
+            cc.mov(tmp, descr.divider);
+            cc.div(hi, value, tmp);
+        }
+        break;
+    default:
+        cc.mov(value, get_ptr_for(jh, traits::INSTRET));
+        break;
+    }
+    if(descr.shift)
+        cc.shr(value, descr.shift);
+    if(rd != 0) {
+        if(traits::XLEN == 32)
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value.r32());
+        else
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value);
+    }
+    gen_sync(jh, POST_SYNC, inst_index);
+    gen_instr_epilogue(jh);
+    if(!req_priv) {
+        pc = pc + 4;
+        return CONT;
+    }
+    cc.jmp(label_done);
+    cc.bind(label_slow);
+    auto cont = (this->*f)(pc, instr, jh);
+    cc.bind(label_done);
+    return cont;
+}
+template <typename ARCH>
+void vm_impl<ARCH>::gen_count_instr(jit_holder& jh, code_word_t instr) {
+    auto& cc = jh.cc;
+    auto const evt = arch::hpm_counters::classify<traits::XLEN>(instr);
+    if(!(hpm->active & (1ULL << evt)))
+        return;
+    cc.comment("//count hpm event");
+    auto counter = get_reg_Gp(cc, 64, false);
+    cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[evt]));
+    cc.inc(x86::qword_ptr(counter));
+    if(evt == arch::HPM_BRANCH && (hpm->active & (1ULL << arch::HPM_BRANCH_TAKEN))) {
+        auto label_not_taken = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::LAST_BRANCH), static_cast<int>(NO_JUMP));
+        cc.je(label_not_taken);
+        cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[arch::HPM_BRANCH_TAKEN]));
+        cc.inc(x86::qword_ptr(counter));
+        cc.bind(label_not_taken);
+    }
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_instr_prologue(jit_holder& jh) {
@@ -12608,6 +13332,7 @@ void vm_impl<ARCH>::gen_instr_epilogue(jit_holder& jh) {
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_block_prologue(jit_holder& jh){
+    block_start = true;
     jh.pc = load_reg_from_mem_Gp(jh, traits::PC);
     jh.next_pc = load_reg_from_mem_Gp(jh, traits::NEXT_PC);
     jh.globals.resize(GLOBALS_SIZE);
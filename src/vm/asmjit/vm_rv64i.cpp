@@ -32,6 +32,7 @@
 
 // clang-format off
 #include <iss/arch/rv64i.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -39,6 +40,7 @@
 #include <asmjit/asmjit.h>
 #include <util/logging.h>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 
 #ifndef FMT_HEADER_ONLY
@@ -115,6 +117,12 @@ protected:
     continuation_e gen_single_inst_behavior(virt_addr_t&, jit_holder&) override;
     enum globals_e {TVAL = 0, GLOBALS_SIZE};
     void gen_block_prologue(jit_holder& jh) override;
+    static void idle_loop_head(void* hart, uint64_t head) { static_cast<arch::riscv_hart_if*>(hart)->idle_loop_head(head); }
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
+    void gen_count_instr(jit_holder& jh, code_word_t instr);
+    continuation_e gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f, jit_holder& jh);
+    bool block_start{false};
     void gen_block_epilogue(jit_holder& jh) override;
     inline const char *name(size_t index){return traits::reg_aliases.at(index);}
 
@@ -277,6 +285,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     /* instruction definitions */
     /* instruction 0: LUI */
     continuation_e __lui(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
@@ -284,14 +295,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -333,14 +347,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,20>(instr) << 12));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -382,14 +399,17 @@ private:
         uint8_t rd = ((bit_sub<7,5>(instr)));
         uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -443,14 +463,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -516,14 +539,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -580,14 +606,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -644,14 +673,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -710,14 +742,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -776,14 +811,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -840,14 +878,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -904,14 +945,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -957,14 +1001,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1010,14 +1057,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1063,14 +1113,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1115,14 +1168,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1167,14 +1223,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1215,14 +1274,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1263,14 +1325,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1311,14 +1376,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1360,14 +1428,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1420,14 +1491,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1480,14 +1554,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1528,14 +1605,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1576,14 +1656,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1624,14 +1707,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,6>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1672,14 +1758,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,6>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1720,14 +1809,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,6>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1770,14 +1862,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1819,14 +1914,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1868,14 +1966,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1916,14 +2017,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -1976,14 +2080,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2036,14 +2143,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2084,14 +2194,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2132,14 +2245,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2181,14 +2297,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2229,14 +2348,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2279,14 +2401,17 @@ private:
         uint8_t pred = ((bit_sub<24,4>(instr)));
         uint8_t fm = ((bit_sub<28,4>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                    fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2316,13 +2441,16 @@ private:
     continuation_e __ecall(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ecall";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ecall";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2353,13 +2481,16 @@ private:
     continuation_e __ebreak(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "ebreak";
+                //No disass specified, using instruction name
+                std::string mnemonic = "ebreak";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2390,13 +2521,16 @@ private:
     continuation_e __mret(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "mret";
+                //No disass specified, using instruction name
+                std::string mnemonic = "mret";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2427,13 +2561,16 @@ private:
     continuation_e __wfi(virt_addr_t& pc, code_word_t instr, jit_holder& jh){
         uint64_t PC = pc.val;
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "wfi";
+                //No disass specified, using instruction name
+                std::string mnemonic = "wfi";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2468,14 +2605,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lwu"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lwu"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2521,14 +2661,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "ld"),
-                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "ld"),
+                    fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2574,14 +2717,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sd"),
-                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sd"),
+                    fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2622,14 +2768,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addiw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addiw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2673,14 +2822,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slliw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slliw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2724,14 +2876,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srliw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srliw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2775,14 +2930,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t shamt = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "sraiw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "sraiw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2826,13 +2984,16 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "addw";
+                //No disass specified, using instruction name
+                std::string mnemonic = "addw";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2878,13 +3039,16 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            //No disass specified, using instruction name
-            std::string mnemonic = "subw";
+                //No disass specified, using instruction name
+                std::string mnemonic = "subw";
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2930,14 +3094,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sllw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sllw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -2983,14 +3150,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srlw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srlw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3036,14 +3206,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint8_t rs2 = ((bit_sub<20,5>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sraw"),
-                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sraw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3089,14 +3262,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3143,14 +3319,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3196,14 +3375,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3249,14 +3431,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3299,14 +3484,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3351,14 +3539,17 @@ private:
         uint8_t zimm = ((bit_sub<15,5>(instr)));
         uint16_t csr = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                    fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3403,14 +3594,17 @@ private:
         uint8_t rs1 = ((bit_sub<15,5>(instr)));
         uint16_t imm = ((bit_sub<20,12>(instr)));
         if(this->disass_enabled){
-            /* generate disass */
+            auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                /* generate disass */
             
-            auto mnemonic = fmt::format(
-                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                auto mnemonic = fmt::format(
+                    "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                    fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                return mnemonic;
+            });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            // the cache owns the text, so it stays valid as long as the translated code
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3442,10 +3636,9 @@ private:
     continuation_e illegal_instruction(virt_addr_t &pc, code_word_t instr, jit_holder& jh ) {
         x86::Compiler& cc = jh.cc;
         if(this->disass_enabled){          
-            auto mnemonic = std::string("illegal_instruction");
+            auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("illegal_instruction"); });
             InvokeNode* call_print_disass;
-            char* mnemonic_ptr = strdup(mnemonic.c_str());
-            jh.disass_collection.push_back(mnemonic_ptr);
+            auto* mnemonic_ptr = const_cast<char*>(text.c_str());
             jh.cc.invoke(&call_print_disass, &print_disass, FuncSignature::build<void, void *, uint64_t, char *>());
             call_print_disass->setArg(0, jh.arch_if_ptr);
             call_print_disass->setArg(1, pc.val);
@@ -3478,7 +3671,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
         }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 template <typename ARCH>
 continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_holder& jh) {
@@ -3490,13 +3687,123 @@ continuation_e vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, jit_hold
         return ILLEGAL_FETCH;
     if (instr == 0x0000006f || (instr&0xffff)==0xa001)
         return JUMP_TO_SELF;
+    if(block_start) {
+        block_start = false;
+        // a block starting an idle loop reports each iteration to the hart
+        if(idle_if && idle_if->idle_loop_detection() && idle_if->is_idle_loop(pc.val)) {
+            InvokeNode* call_idle_loop_head;
+            jh.cc.invoke(&call_idle_loop_head, &idle_loop_head, FuncSignature::build<void, void*, uint64_t>());
+            call_idle_loop_head->setArg(0, static_cast<void*>(idle_if));
+            call_idle_loop_head->setArg(1, pc.val);
+        }
+    }
     uint32_t inst_index = instr_decoder.decode_instr(instr);
     compile_func f = nullptr;
     if(inst_index < instr_descr.size())
         f = instr_descr[inst_index].op;
     if (f == nullptr) 
         f = &this_class::illegal_instruction;
-    return (this->*f)(pc, instr, jh);
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    auto cont = is_csr_read && f != &this_class::illegal_instruction ? gen_inline_csr_read(pc, instr, inst_index, f, jh)
+                                                                      : (this->*f)(pc, instr, jh);
+    if(hpm && hpm->instr_active)
+        gen_count_instr(jh, instr);
+    // the selected events are compiled into the code, so it needs to be retranslated if mhpmevent or mcountinhibit are
+    // written. csrrs/csrrc with x0 and the immediate variants with 0 only read the CSR
+    auto const csr = instr >> 20;
+    if(cont == CONT && (instr & 0x7f) == 0x73 && (instr & 0x3000) && !is_csr_read && csr >= 0x320 && csr < 0x340)
+        return FLUSH;
+    return cont;
+}
+template <typename ARCH>
+continuation_e vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t& pc, code_word_t instr, uint32_t inst_index, compile_func f,
+                                                  jit_holder& jh) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = idle_if ? idle_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, jh);
+    auto& cc = jh.cc;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    auto const req_priv = (csr >> 8) & 0x3;
+    Label label_slow, label_done;
+    if(req_priv) {
+        label_slow = cc.newLabel();
+        label_done = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::PRIV), req_priv);
+        cc.jb(label_slow);
+    }
+    cc.comment(fmt::format("CSR_READ_{:#x}:", pc.val).c_str());
+    gen_sync(jh, PRE_SYNC, inst_index);
+    mov(cc, jh.pc, pc.val);
+    gen_set_tval(jh, instr);
+    mov(cc, jh.next_pc, pc.val + 4);
+    cc.mov(get_ptr_for(jh, traits::INSTRUCTION), instr);
+    gen_instr_prologue(jh);
+    auto value = get_reg_Gp(cc, 64, false);
+    auto tmp = get_reg_Gp(cc, 64, false);
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN:
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.ptr));
+        if(traits::XLEN == 32)
+            cc.mov(value.r32(), x86::dword_ptr(tmp));
+        else
+            cc.mov(value, x86::qword_ptr(tmp));
+        break;
+    case arch::csr_inline_read::CYCLE:
+        cc.mov(value, get_ptr_for(jh, traits::CYCLE));
+        cc.mov(tmp, reinterpret_cast<uint64_t>(descr.offset));
+        cc.add(value, x86::qword_ptr(tmp));
+        if(descr.divider > 1) {
+            auto hi = get_reg_Gp(cc, 64, false);
+            cc.xor_(hi, hi);
+            cc.mov(tmp, descr.divider);
+            cc.div(hi, value, tmp);
+        }
+        break;
+    default:
+        cc.mov(value, get_ptr_for(jh, traits::INSTRET));
+        break;
+    }
+    if(descr.shift)
+        cc.shr(value, descr.shift);
+    if(rd != 0) {
+        if(traits::XLEN == 32)
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value.r32());
+        else
+            cc.mov(get_ptr_for(jh, traits::X0 + rd), value);
+    }
+    gen_sync(jh, POST_SYNC, inst_index);
+    gen_instr_epilogue(jh);
+    if(!req_priv) {
+        pc = pc + 4;
+        return CONT;
+    }
+    cc.jmp(label_done);
+    cc.bind(label_slow);
+    auto cont = (this->*f)(pc, instr, jh);
+    cc.bind(label_done);
+    return cont;
+}
+template <typename ARCH>
+void vm_impl<ARCH>::gen_count_instr(jit_holder& jh, code_word_t instr) {
+    auto& cc = jh.cc;
+    auto const evt = arch::hpm_counters::classify<traits::XLEN>(instr);
+    if(!(hpm->active & (1ULL << evt)))
+        return;
+    cc.comment("//count hpm event");
+    auto counter = get_reg_Gp(cc, 64, false);
+    cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[evt]));
+    cc.inc(x86::qword_ptr(counter));
+    if(evt == arch::HPM_BRANCH && (hpm->active & (1ULL << arch::HPM_BRANCH_TAKEN))) {
+        auto label_not_taken = cc.newLabel();
+        cc.cmp(get_ptr_for(jh, traits::LAST_BRANCH), static_cast<int>(NO_JUMP));
+        cc.je(label_not_taken);
+        cc.mov(counter, reinterpret_cast<uint64_t>(&hpm->events[arch::HPM_BRANCH_TAKEN]));
+        cc.inc(x86::qword_ptr(counter));
+        cc.bind(label_not_taken);
+    }
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_instr_prologue(jit_holder& jh) {
@@ -3525,6 +3832,7 @@ void vm_impl<ARCH>::gen_instr_epilogue(jit_holder& jh) {
 }
 template <typename ARCH>
 void vm_impl<ARCH>::gen_block_prologue(jit_holder& jh){
+    block_start = true;
     jh.pc = load_reg_from_mem_Gp(jh, traits::PC);
     jh.next_pc = load_reg_from_mem_Gp(jh, traits::NEXT_PC);
     jh.globals.resize(GLOBALS_SIZE);
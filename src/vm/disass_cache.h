@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (C) 2025 MINRES Technologies GmbH
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Contributors:
+ *       eyck@minres.com - initial implementation
+ ******************************************************************************/
+
+#ifndef _VM_DISASS_CACHE_H_
+#define _VM_DISASS_CACHE_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace iss {
+/**
+ * the formatted disassembly of the instructions keyed by their address and instruction word. The text depends on
+ * nothing else, so modified code yields a new entry and the cache never needs to be invalidated. Entries are neither
+ * moved nor freed while the cache exists, hence translated code may keep pointers to them. A direct mapped table of
+ * the recently used entries avoids the hash lookup when executing loops.
+ */
+class disass_cache {
+public:
+    //! returns the text of the instruction at pc, format() is only called the first time pc and instr are seen
+    template <typename F> std::string const& get(uint64_t pc, uint32_t instr, F&& format) {
+        auto& r = recent[(pc >> 1) & (recent_size - 1)];
+        if(r.text && r.pc == pc && r.instr == instr)
+            return *r.text;
+        auto it = entries.find({pc, instr});
+        if(it == entries.end())
+            it = entries.emplace(key{pc, instr}, format()).first;
+        r = {pc, instr, &it->second};
+        return it->second;
+    }
+
+    size_t size() const { return entries.size(); }
+
+private:
+    struct key {
+        uint64_t pc;
+        uint32_t instr;
+        bool operator==(key const& o) const { return pc == o.pc && instr == o.instr; }
+    };
+    struct key_hash {
+        size_t operator()(key const& k) const { return std::hash<uint64_t>()(k.pc ^ static_cast<uint64_t>(k.instr) << 32); }
+    };
+    struct recent_entry {
+        uint64_t pc;
+        uint32_t instr;
+        std::string const* text;
+    };
+    static constexpr unsigned recent_size = 1024;
+    std::array<recent_entry, recent_size> recent{};
+    std::unordered_map<key, std::string, key_hash> entries;
+};
+} // namespace iss
+#endif /* _VM_DISASS_CACHE_H_ */
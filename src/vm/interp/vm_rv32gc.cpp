@@ -33,6 +33,7 @@
 // clang-format off
 #include <cstdint>
 #include <iss/arch/rv32gc.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -47,6 +48,7 @@
 #include <exception>
 #include <vector>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 
 #ifndef FMT_HEADER_ONLY
@@ -65,10 +67,6 @@ using namespace iss::arch;
 using namespace iss::debugger;
 using namespace std::placeholders;
 
-struct memory_access_exception : public std::exception{
-    memory_access_exception(){}
-};
-
 template <typename ARCH> class vm_impl : public iss::interp::vm_base<ARCH> {
 public:
     using traits = arch::traits<ARCH>;
@@ -127,6 +125,8 @@ protected:
     }
     uint64_t fetch_count{0};
     uint64_t tval{0};
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
 
     using yield_t = boost::coroutines2::coroutine<void>::push_type;
     using coro_t = boost::coroutines2::coroutine<void>::pull_type;
@@ -357,6 +357,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     iss::status fetch_ins(virt_addr_t pc, uint8_t * data){
         if (this->core.read({iss::address_type::LOGICAL, pc.access, arch::traits<ARCH>::IMEM, pc.val}, 4, data) != iss::Ok)
                     return iss::Err;
@@ -393,7 +396,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
     }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 inline bool is_icount_limit_enabled(finish_cond_e cond){
     return (cond & finish_cond_e::ICOUNT_LIMIT) == finish_cond_e::ICOUNT_LIMIT;
@@ -442,17 +449,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             // pre execution stuff
              this->core.reg.last_branch = 0;
             if(this->sync_exec && PRE_SYNC) this->do_sync(PRE_SYNC, static_cast<unsigned>(inst_id));
-            try{
                 switch(inst_id){
                 case arch::traits<ARCH>::opcode_e::LUI: {
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -475,11 +484,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -502,11 +514,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -539,11 +554,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -577,11 +595,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -613,11 +634,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -649,11 +673,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -685,11 +712,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -721,11 +751,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -757,11 +790,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -793,11 +829,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -811,7 +850,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int8_t res_1 = super::template read_mem<int8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int8_t res = (int8_t)res_1;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -825,11 +864,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -843,7 +885,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int16_t res_2 = super::template read_mem<int16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int16_t res = (int16_t)res_2;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -857,11 +899,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -875,7 +920,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int32_t res_3 = super::template read_mem<int32_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res = (int32_t)res_3;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -889,11 +934,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -907,7 +955,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint8_t res_4 = super::template read_mem<uint8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint8_t res = res_4;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -921,11 +969,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -939,7 +990,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint16_t res_5 = super::template read_mem<uint16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint16_t res = res_5;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -953,11 +1004,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -971,7 +1025,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint8_t>(traits::MEM, store_address, (uint8_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -981,11 +1035,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -999,7 +1056,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint16_t>(traits::MEM, store_address, (uint16_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -1009,11 +1066,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1027,7 +1087,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint32_t>(traits::MEM, store_address, (uint32_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -1037,11 +1097,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1065,11 +1128,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1093,11 +1159,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1121,11 +1190,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1149,11 +1221,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1177,11 +1252,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1205,11 +1283,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1233,11 +1314,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1261,11 +1345,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1289,11 +1376,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1317,11 +1407,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1345,11 +1438,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1373,11 +1469,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1401,11 +1500,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1429,11 +1531,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1457,11 +1562,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1485,11 +1593,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1513,11 +1624,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1541,11 +1655,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1571,11 +1688,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t pred = ((bit_sub<24,4>(instr)));
                     uint8_t fm = ((bit_sub<28,4>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                            fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1583,16 +1703,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint32_t>(traits::FENCE, traits::fence, (uint8_t)pred << 4 | succ);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::ECALL: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ecall";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ecall";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1605,10 +1728,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::EBREAK: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ebreak";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ebreak";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1621,10 +1747,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::MRET: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "mret";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "mret";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1637,10 +1766,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::WFI: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "wfi";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "wfi";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1656,11 +1788,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1675,15 +1810,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rd != 0) {
                                             uint32_t res_6 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             uint32_t xrd = res_6;
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = xrd;
                                         }
                                         else {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -1694,11 +1829,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1711,12 +1849,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_7 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_7;
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd | xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1730,11 +1868,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1747,12 +1888,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_8 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_8;
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd & ~xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1766,11 +1907,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1783,10 +1927,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_9 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_9;
                                         super::template write_mem<uint32_t>(traits::CSR, csr, (uint32_t)zimm);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
                                         }
@@ -1799,11 +1943,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1816,11 +1963,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_10 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_10;
                                         if(zimm != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd | (uint32_t)zimm);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1834,11 +1981,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1851,11 +2001,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_11 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_11;
                                         if(zimm != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd & ~((uint32_t)zimm));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1869,11 +2019,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1881,7 +2034,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint32_t>(traits::FENCE, traits::fencei, imm);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
@@ -1890,11 +2043,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1919,11 +2075,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1948,11 +2107,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1977,11 +2139,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2006,11 +2171,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2047,11 +2215,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2082,11 +2253,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2125,11 +2299,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2161,11 +2338,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2180,10 +2360,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         if(rd != 0) {
                                             uint32_t offs = *(X+rs1);
                                             int32_t res_12 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint32_t)((int32_t)res_12);
                                             super::template write_mem<uint8_t>(traits::RES, offs, (uint8_t)- 1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -2196,11 +2376,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2214,11 +2397,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint8_t res_13 = super::template read_mem<uint8_t>(traits::RES, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_13;
                                         if(res1 != 0) {
                                             super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = res1? 0 : 1;
@@ -2234,11 +2417,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2254,11 +2440,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint32_t res = *(X+rs2);
                                         if(rd != 0) {
                                             int32_t res_14 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint32_t)((int32_t)res_14);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)res);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2270,11 +2456,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2288,14 +2477,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         int32_t res_15 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_15;
                                         int64_t res2 = (int64_t)(res1) + (int64_t)((int32_t)*(X+rs2));
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2307,11 +2496,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2325,14 +2517,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_16 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_16;
                                         uint32_t res2 = res1 ^ (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2344,11 +2536,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2362,14 +2557,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_17 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_17;
                                         uint32_t res2 = res1 & (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2381,11 +2576,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2399,14 +2597,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_18 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_18;
                                         uint32_t res2 = res1 | (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2418,11 +2616,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2436,14 +2637,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         int32_t res_19 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_19;
                                         uint32_t res2 = res1 > (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : ((uint32_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2455,11 +2656,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2473,14 +2677,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         int32_t res_20 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_20;
                                         uint32_t res2 = res1 < (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : ((uint32_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2492,11 +2696,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2510,14 +2717,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_21 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_21;
                                         uint32_t res2 = res1 > (uint32_t)*(X+rs2)? (uint32_t)*(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2529,11 +2736,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2547,14 +2757,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_22 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_22;
                                         uint32_t res2 = res1 < (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2563,11 +2773,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<2,3>(instr)));
                     uint16_t imm = ((bit_sub<5,1>(instr) << 3) | (bit_sub<6,1>(instr) << 2) | (bit_sub<7,4>(instr) << 6) | (bit_sub<11,2>(instr) << 4));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2589,11 +2802,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2603,7 +2819,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         int32_t res_23 = super::template read_mem<int32_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         *(X+rd + 8) = (uint32_t)(int32_t)res_23;
                     }
                     break;
@@ -2613,11 +2829,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
-                            fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
+                                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2627,7 +2846,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2 + 8));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -2635,11 +2854,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2661,10 +2883,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__NOP: {
                     uint8_t nzimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "c.nop";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "c.nop";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -2677,11 +2902,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JAL: {
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
-                            fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
+                                fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2699,11 +2927,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2726,11 +2957,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint32_t imm = ((bit_sub<2,5>(instr) << 12) | (bit_sub<12,1>(instr) << 17));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2750,11 +2984,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__ADDI16SP: {
                     uint16_t nzimm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 7) | (bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 4) | (bit_sub<12,1>(instr) << 9));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
-                            fmt::arg("nzimm", nzimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
+                                fmt::arg("nzimm", nzimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2774,10 +3011,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::__reserved_clui: {
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = ".reserved_clui";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = ".reserved_clui";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -2792,11 +3032,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t shamt = ((bit_sub<2,5>(instr)));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2812,11 +3055,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t shamt = ((bit_sub<2,5>(instr)));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2839,11 +3085,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2859,11 +3108,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2879,11 +3131,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2899,11 +3154,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2919,11 +3177,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2938,11 +3199,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__J: {
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
-                            fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
+                                fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -2958,11 +3222,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2981,11 +3248,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3004,11 +3274,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t nzuimm = ((bit_sub<2,5>(instr)));
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3031,11 +3304,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.lwsp"),
-                            fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.lwsp"),
+                                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3049,7 +3325,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                         else {
                             uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                             int32_t res_24 = super::template read_mem<int32_t>(traits::MEM, offs);
-                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                             *(X+rd) = (uint32_t)(int32_t)res_24;
                         }
                     }
@@ -3059,11 +3335,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3085,11 +3364,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JR: {
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
-                            fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
+                                fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3110,10 +3392,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::__reserved_cmv: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = ".reserved_cmv";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = ".reserved_cmv";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3128,11 +3413,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3154,11 +3442,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JALR: {
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
-                            fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
+                                fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3181,10 +3472,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::C__EBREAK: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "c.ebreak";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "c.ebreak";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3199,11 +3493,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3217,17 +3514,20 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::DII: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "dii";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "dii";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3243,11 +3543,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3262,7 +3565,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint32_t res_25 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         *(F+rd) = NaNBox32(res_25);
                                     }
                                 }
@@ -3273,11 +3576,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
-                            fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
+                                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3292,7 +3598,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(F+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3303,11 +3609,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3328,11 +3637,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3353,11 +3665,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3378,11 +3693,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3402,11 +3720,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3426,11 +3747,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3450,11 +3774,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3476,11 +3803,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3502,11 +3832,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3528,11 +3861,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3554,11 +3890,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -3578,11 +3917,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3611,11 +3953,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3644,11 +3989,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3674,11 +4022,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3704,11 +4055,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3725,11 +4079,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3746,11 +4103,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3766,11 +4126,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3794,11 +4157,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3821,11 +4187,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3854,11 +4223,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3887,11 +4259,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3919,11 +4294,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -3949,11 +4327,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.flw"),
-                            fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.flw"),
+                                fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3964,7 +4345,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         uint32_t res_26 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         uint32_t res = (uint32_t)res_26;
                         *(F+rd + 8) = NaNBox32(res);
                     }
@@ -3975,11 +4356,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsw"),
-                            fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsw"),
+                                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3990,7 +4374,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(F+rs2 + 8));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -3998,11 +4382,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.flwsp"),
-                            fmt::arg("rd", rd), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.flwsp"),
+                                fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4013,7 +4400,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                         uint32_t res_27 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         uint32_t res = (uint32_t)res_27;
                         *(F+rd) = NaNBox32(res);
                     }
@@ -4023,11 +4410,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fswsp"),
-                            fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fswsp"),
+                                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4038,7 +4428,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(F+rs2));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -4047,11 +4437,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4066,7 +4459,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint64_t res_28 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         *(F+rd) = NaNBox64(res_28);
                                     }
                                 }
@@ -4077,11 +4470,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
-                            fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
+                                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4096,7 +4492,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(F+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -4107,11 +4503,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4132,11 +4531,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4157,11 +4559,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4182,11 +4587,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4206,11 +4614,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4230,11 +4641,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4254,11 +4668,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4280,11 +4697,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4306,11 +4726,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4333,11 +4756,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4359,11 +4785,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4383,11 +4812,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4416,11 +4848,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4449,11 +4884,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4479,11 +4917,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4509,11 +4950,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4533,11 +4977,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4554,11 +5001,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4575,11 +5025,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4596,11 +5049,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4617,11 +5073,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4650,11 +5109,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4683,11 +5145,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4715,11 +5180,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4745,11 +5213,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
-                            fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
+                                fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4760,7 +5231,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         uint64_t res_29 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         uint64_t res = (uint64_t)res_29;
                         *(F+rd + 8) = NaNBox64(res);
                     }
@@ -4771,11 +5242,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
-                            fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
+                                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4786,7 +5260,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(F+rs2 + 8));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -4794,11 +5268,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t uimm = ((bit_sub<2,3>(instr) << 6) | (bit_sub<5,2>(instr) << 3) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
-                            fmt::arg("rd", rd), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
+                                fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4809,7 +5286,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                         uint64_t res_30 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         uint64_t res = (uint64_t)res_30;
                         *(F+rd) = NaNBox64(res);
                     }
@@ -4819,11 +5296,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint16_t uimm = ((bit_sub<7,3>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
-                            fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
+                                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4834,7 +5314,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(F+rs2));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -4842,11 +5322,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t asid = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -4854,16 +5337,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint32_t>(traits::FENCE, traits::fencevma, ((uint16_t)(uint8_t)rs1<<8)|(uint8_t)asid);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::SRET: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "sret";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "sret";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -4883,14 +5369,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                         }
                     }
                     if(this->disass_enabled){
-                        std::string mnemonic = "Illegal Instruction";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("Illegal Instruction"); });
+                        this->core.disass_output(pc.val, text);
                     }
                     *NEXT_PC = *PC + ((instr & 3) == 3 ? 4 : 2);
                     raise(0, traits::RV_CAUSE_ILLEGAL_INSTRUCTION);
                 }
                 }
-            }catch(memory_access_exception& e){}
+            // memory access faults skip the remainder of the instruction behavior
+            trap_exit:
             // post execution stuff
             process_spawn_blocks();
             if(this->sync_exec && POST_SYNC) this->do_sync(POST_SYNC, static_cast<unsigned>(inst_id));
@@ -4904,6 +5391,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             } else {
                 icount++;
                 instret++;
+                // a short backward jump may close an idle loop
+                if(*NEXT_PC < pc.val && pc.val - *NEXT_PC <= idle_loop_max_span && idle_if && idle_if->idle_loop_detection())
+                    idle_if->idle_loop_head(*NEXT_PC);
+                if(hpm && hpm->instr_active)
+                    hpm->count_instr<traits::XLEN>(instr, this->core.reg.last_branch != 0);
             }
             *PC = *NEXT_PC;
             this->core.reg.trap_state =  this->core.reg.pending_trap;
@@ -33,6 +33,7 @@
 // clang-format off
 #include <cstdint>
 #include <iss/arch/rv32i.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -45,6 +46,7 @@
 #include <exception>
 #include <vector>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 
 #ifndef FMT_HEADER_ONLY
@@ -63,10 +65,6 @@ using namespace iss::arch;
 using namespace iss::debugger;
 using namespace std::placeholders;
 
-struct memory_access_exception : public std::exception{
-    memory_access_exception(){}
-};
-
 template <typename ARCH> class vm_impl : public iss::interp::vm_base<ARCH> {
 public:
     using traits = arch::traits<ARCH>;
@@ -123,6 +121,8 @@ protected:
     }
     uint64_t fetch_count{0};
     uint64_t tval{0};
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
 
     using yield_t = boost::coroutines2::coroutine<void>::push_type;
     using coro_t = boost::coroutines2::coroutine<void>::pull_type;
@@ -213,6 +213,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     iss::status fetch_ins(virt_addr_t pc, uint8_t * data){
         if (this->core.read({iss::address_type::LOGICAL, pc.access, arch::traits<ARCH>::IMEM, pc.val}, 4, data) != iss::Ok)
                     return iss::Err;
@@ -249,7 +252,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
     }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 inline bool is_icount_limit_enabled(finish_cond_e cond){
     return (cond & finish_cond_e::ICOUNT_LIMIT) == finish_cond_e::ICOUNT_LIMIT;
@@ -298,17 +305,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             // pre execution stuff
              this->core.reg.last_branch = 0;
             if(this->sync_exec && PRE_SYNC) this->do_sync(PRE_SYNC, static_cast<unsigned>(inst_id));
-            try{
                 switch(inst_id){
                 case arch::traits<ARCH>::opcode_e::LUI: {
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -331,11 +340,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -358,11 +370,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -395,11 +410,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -433,11 +451,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -469,11 +490,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -505,11 +529,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -541,11 +568,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -577,11 +607,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -613,11 +646,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -649,11 +685,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -667,7 +706,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int8_t res_1 = super::template read_mem<int8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int8_t res = (int8_t)res_1;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -681,11 +720,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -699,7 +741,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int16_t res_2 = super::template read_mem<int16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int16_t res = (int16_t)res_2;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -713,11 +755,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -731,7 +776,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int32_t res_3 = super::template read_mem<int32_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res = (int32_t)res_3;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -745,11 +790,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -763,7 +811,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint8_t res_4 = super::template read_mem<uint8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint8_t res = res_4;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -777,11 +825,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -795,7 +846,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint16_t res_5 = super::template read_mem<uint16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint16_t res = res_5;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -809,11 +860,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -827,7 +881,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint8_t>(traits::MEM, store_address, (uint8_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -837,11 +891,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -855,7 +912,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint16_t>(traits::MEM, store_address, (uint16_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -865,11 +922,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -883,7 +943,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint32_t>(traits::MEM, store_address, (uint32_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -893,11 +953,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -921,11 +984,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -949,11 +1015,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -977,11 +1046,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1005,11 +1077,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1033,11 +1108,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1061,11 +1139,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1089,11 +1170,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1117,11 +1201,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1145,11 +1232,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1173,11 +1263,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1201,11 +1294,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1229,11 +1325,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1257,11 +1356,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1285,11 +1387,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1313,11 +1418,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1341,11 +1449,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1369,11 +1480,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1397,11 +1511,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1427,11 +1544,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t pred = ((bit_sub<24,4>(instr)));
                     uint8_t fm = ((bit_sub<28,4>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                            fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1439,16 +1559,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint32_t>(traits::FENCE, traits::fence, (uint8_t)pred << 4 | succ);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::ECALL: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ecall";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ecall";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1461,10 +1584,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::EBREAK: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ebreak";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ebreak";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1477,10 +1603,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::MRET: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "mret";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "mret";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1493,10 +1622,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::WFI: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "wfi";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "wfi";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1512,11 +1644,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1531,15 +1666,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rd != 0) {
                                             uint32_t res_6 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             uint32_t xrd = res_6;
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = xrd;
                                         }
                                         else {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -1550,11 +1685,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1567,12 +1705,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_7 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_7;
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd | xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1586,11 +1724,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1603,12 +1744,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_8 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_8;
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd & ~xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1622,11 +1763,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1639,10 +1783,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_9 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_9;
                                         super::template write_mem<uint32_t>(traits::CSR, csr, (uint32_t)zimm);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
                                         }
@@ -1655,11 +1799,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1672,11 +1819,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_10 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_10;
                                         if(zimm != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd | (uint32_t)zimm);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1690,11 +1837,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1707,11 +1857,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_11 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_11;
                                         if(zimm != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd & ~((uint32_t)zimm));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1725,11 +1875,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1737,7 +1890,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint32_t>(traits::FENCE, traits::fencei, imm);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
@@ -1750,14 +1903,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                         }
                     }
                     if(this->disass_enabled){
-                        std::string mnemonic = "Illegal Instruction";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("Illegal Instruction"); });
+                        this->core.disass_output(pc.val, text);
                     }
                     *NEXT_PC = *PC + ((instr & 3) == 3 ? 4 : 2);
                     raise(0, traits::RV_CAUSE_ILLEGAL_INSTRUCTION);
                 }
                 }
-            }catch(memory_access_exception& e){}
+            // memory access faults skip the remainder of the instruction behavior
+            trap_exit:
             // post execution stuff
             process_spawn_blocks();
             if(this->sync_exec && POST_SYNC) this->do_sync(POST_SYNC, static_cast<unsigned>(inst_id));
@@ -1771,6 +1925,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             } else {
                 icount++;
                 instret++;
+                // a short backward jump may close an idle loop
+                if(*NEXT_PC < pc.val && pc.val - *NEXT_PC <= idle_loop_max_span && idle_if && idle_if->idle_loop_detection())
+                    idle_if->idle_loop_head(*NEXT_PC);
+                if(hpm && hpm->instr_active)
+                    hpm->count_instr<traits::XLEN>(instr, this->core.reg.last_branch != 0);
             }
             *PC = *NEXT_PC;
             this->core.reg.trap_state =  this->core.reg.pending_trap;
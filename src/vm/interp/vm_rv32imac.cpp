@@ -33,6 +33,7 @@
 // clang-format off
 #include <cstdint>
 #include <iss/arch/rv32imac.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -45,6 +46,7 @@
 #include <exception>
 #include <vector>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 
 #ifndef FMT_HEADER_ONLY
@@ -63,10 +65,6 @@ using namespace iss::arch;
 using namespace iss::debugger;
 using namespace std::placeholders;
 
-struct memory_access_exception : public std::exception{
-    memory_access_exception(){}
-};
-
 template <typename ARCH> class vm_impl : public iss::interp::vm_base<ARCH> {
 public:
     using traits = arch::traits<ARCH>;
@@ -123,6 +121,8 @@ protected:
     }
     uint64_t fetch_count{0};
     uint64_t tval{0};
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
 
     using yield_t = boost::coroutines2::coroutine<void>::push_type;
     using coro_t = boost::coroutines2::coroutine<void>::pull_type;
@@ -262,6 +262,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     iss::status fetch_ins(virt_addr_t pc, uint8_t * data){
         if (this->core.read({iss::address_type::LOGICAL, pc.access, arch::traits<ARCH>::IMEM, pc.val}, 4, data) != iss::Ok)
                     return iss::Err;
@@ -298,7 +301,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
     }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 inline bool is_icount_limit_enabled(finish_cond_e cond){
     return (cond & finish_cond_e::ICOUNT_LIMIT) == finish_cond_e::ICOUNT_LIMIT;
@@ -347,17 +354,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             // pre execution stuff
              this->core.reg.last_branch = 0;
             if(this->sync_exec && PRE_SYNC) this->do_sync(PRE_SYNC, static_cast<unsigned>(inst_id));
-            try{
                 switch(inst_id){
                 case arch::traits<ARCH>::opcode_e::LUI: {
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -380,11 +389,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -407,11 +419,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -444,11 +459,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -482,11 +500,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -518,11 +539,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -554,11 +578,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -590,11 +617,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -626,11 +656,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -662,11 +695,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -698,11 +734,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -716,7 +755,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int8_t res_1 = super::template read_mem<int8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int8_t res = (int8_t)res_1;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -730,11 +769,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -748,7 +790,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int16_t res_2 = super::template read_mem<int16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int16_t res = (int16_t)res_2;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -762,11 +804,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -780,7 +825,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         int32_t res_3 = super::template read_mem<int32_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res = (int32_t)res_3;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -794,11 +839,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -812,7 +860,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint8_t res_4 = super::template read_mem<uint8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint8_t res = res_4;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -826,11 +874,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -844,7 +895,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t load_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         uint16_t res_5 = super::template read_mem<uint16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint16_t res = res_5;
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res;
@@ -858,11 +909,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -876,7 +930,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint8_t>(traits::MEM, store_address, (uint8_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -886,11 +940,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -904,7 +961,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint16_t>(traits::MEM, store_address, (uint16_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -914,11 +971,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -932,7 +992,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t store_address = (uint32_t)((uint64_t)(*(X+rs1)) + (int64_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint32_t>(traits::MEM, store_address, (uint32_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -942,11 +1002,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -970,11 +1033,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -998,11 +1064,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1026,11 +1095,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1054,11 +1126,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1082,11 +1157,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1110,11 +1188,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1138,11 +1219,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1166,11 +1250,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1194,11 +1281,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1222,11 +1312,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1250,11 +1343,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1278,11 +1374,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1306,11 +1405,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1334,11 +1436,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1362,11 +1467,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1390,11 +1498,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1418,11 +1529,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1446,11 +1560,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1476,11 +1593,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t pred = ((bit_sub<24,4>(instr)));
                     uint8_t fm = ((bit_sub<28,4>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                            fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1488,16 +1608,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint32_t>(traits::FENCE, traits::fence, (uint8_t)pred << 4 | succ);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::ECALL: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ecall";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ecall";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1510,10 +1633,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::EBREAK: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ebreak";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ebreak";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1526,10 +1652,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::MRET: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "mret";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "mret";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1542,10 +1671,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::WFI: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "wfi";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "wfi";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1561,11 +1693,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1580,15 +1715,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rd != 0) {
                                             uint32_t res_6 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             uint32_t xrd = res_6;
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = xrd;
                                         }
                                         else {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -1599,11 +1734,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1616,12 +1754,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_7 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_7;
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd | xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1635,11 +1773,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1652,12 +1793,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_8 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_8;
                                         uint32_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd & ~xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1671,11 +1812,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1688,10 +1832,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_9 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_9;
                                         super::template write_mem<uint32_t>(traits::CSR, csr, (uint32_t)zimm);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
                                         }
@@ -1704,11 +1848,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1721,11 +1868,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_10 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_10;
                                         if(zimm != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd | (uint32_t)zimm);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1739,11 +1886,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1756,11 +1906,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint32_t res_11 = super::template read_mem<uint32_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t xrd = res_11;
                                         if(zimm != 0) {
                                             super::template write_mem<uint32_t>(traits::CSR, csr, xrd & ~((uint32_t)zimm));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -1774,11 +1924,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1786,7 +1939,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint32_t>(traits::FENCE, traits::fencei, imm);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
@@ -1795,11 +1948,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1824,11 +1980,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1853,11 +2012,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1882,11 +2044,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1911,11 +2076,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1952,11 +2120,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1987,11 +2158,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2030,11 +2204,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2066,11 +2243,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2085,10 +2265,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         if(rd != 0) {
                                             uint32_t offs = *(X+rs1);
                                             int32_t res_12 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint32_t)((int32_t)res_12);
                                             super::template write_mem<uint8_t>(traits::RES, offs, (uint8_t)- 1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -2101,11 +2281,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2119,11 +2302,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint8_t res_13 = super::template read_mem<uint8_t>(traits::RES, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_13;
                                         if(res1 != 0) {
                                             super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = res1? 0 : 1;
@@ -2139,11 +2322,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2159,11 +2345,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint32_t res = *(X+rs2);
                                         if(rd != 0) {
                                             int32_t res_14 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint32_t)((int32_t)res_14);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)res);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2175,11 +2361,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2193,14 +2382,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         int32_t res_15 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_15;
                                         int64_t res2 = (int64_t)(res1) + (int64_t)((int32_t)*(X+rs2));
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2212,11 +2401,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2230,14 +2422,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_16 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_16;
                                         uint32_t res2 = res1 ^ (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2249,11 +2441,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2267,14 +2462,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_17 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_17;
                                         uint32_t res2 = res1 & (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2286,11 +2481,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2304,14 +2502,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_18 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_18;
                                         uint32_t res2 = res1 | (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2323,11 +2521,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2341,14 +2542,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         int32_t res_19 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_19;
                                         uint32_t res2 = res1 > (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : ((uint32_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2360,11 +2561,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2378,14 +2582,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         int32_t res_20 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_20;
                                         uint32_t res2 = res1 < (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : ((uint32_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint32_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2397,11 +2601,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2415,14 +2622,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_21 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_21;
                                         uint32_t res2 = res1 > (uint32_t)*(X+rs2)? (uint32_t)*(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2434,11 +2641,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2452,14 +2662,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = *(X+rs1);
                                         uint32_t res_22 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_22;
                                         uint32_t res2 = res1 < (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = ((uint32_t)(int32_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2468,11 +2678,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<2,3>(instr)));
                     uint16_t imm = ((bit_sub<5,1>(instr) << 3) | (bit_sub<6,1>(instr) << 2) | (bit_sub<7,4>(instr) << 6) | (bit_sub<11,2>(instr) << 4));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2494,11 +2707,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2508,7 +2724,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         int32_t res_23 = super::template read_mem<int32_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         *(X+rd + 8) = (uint32_t)(int32_t)res_23;
                     }
                     break;
@@ -2518,11 +2734,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
-                            fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
+                                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2532,7 +2751,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint32_t offs = (uint32_t)((uint64_t)(*(X+rs1 + 8)) + (uint64_t)(uimm));
                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2 + 8));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -2540,11 +2759,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2566,10 +2788,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__NOP: {
                     uint8_t nzimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "c.nop";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "c.nop";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -2582,11 +2807,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JAL: {
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
-                            fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.jal"),
+                                fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2604,11 +2832,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2631,11 +2862,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint32_t imm = ((bit_sub<2,5>(instr) << 12) | (bit_sub<12,1>(instr) << 17));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2655,11 +2889,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__ADDI16SP: {
                     uint16_t nzimm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 7) | (bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 4) | (bit_sub<12,1>(instr) << 9));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
-                            fmt::arg("nzimm", nzimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
+                                fmt::arg("nzimm", nzimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2679,10 +2916,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::__reserved_clui: {
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = ".reserved_clui";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = ".reserved_clui";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -2697,11 +2937,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t shamt = ((bit_sub<2,5>(instr)));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srli"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2717,11 +2960,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t shamt = ((bit_sub<2,5>(instr)));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2744,11 +2990,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2764,11 +3013,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2784,11 +3036,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2804,11 +3059,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2824,11 +3082,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2843,11 +3104,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__J: {
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
-                            fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
+                                fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -2863,11 +3127,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2886,11 +3153,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2909,11 +3179,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t nzuimm = ((bit_sub<2,5>(instr)));
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.slli"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("nzuimm", nzuimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2936,11 +3209,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.lwsp"),
-                            fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.lwsp"),
+                                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2954,7 +3230,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                         else {
                             uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                             int32_t res_24 = super::template read_mem<int32_t>(traits::MEM, offs);
-                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                             *(X+rd) = (uint32_t)(int32_t)res_24;
                         }
                     }
@@ -2964,11 +3240,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2990,11 +3269,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JR: {
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
-                            fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
+                                fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3015,10 +3297,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::__reserved_cmv: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = ".reserved_cmv";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = ".reserved_cmv";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3033,11 +3318,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3059,11 +3347,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JALR: {
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
-                            fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
+                                fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3086,10 +3377,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::C__EBREAK: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "c.ebreak";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "c.ebreak";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3104,11 +3398,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint32_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3122,17 +3419,20 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint32_t offs = (uint32_t)((uint64_t)(*(X+2)) + (uint64_t)(uimm));
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::DII: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "dii";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "dii";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3152,14 +3452,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                         }
                     }
                     if(this->disass_enabled){
-                        std::string mnemonic = "Illegal Instruction";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("Illegal Instruction"); });
+                        this->core.disass_output(pc.val, text);
                     }
                     *NEXT_PC = *PC + ((instr & 3) == 3 ? 4 : 2);
                     raise(0, traits::RV_CAUSE_ILLEGAL_INSTRUCTION);
                 }
                 }
-            }catch(memory_access_exception& e){}
+            // memory access faults skip the remainder of the instruction behavior
+            trap_exit:
             // post execution stuff
             process_spawn_blocks();
             if(this->sync_exec && POST_SYNC) this->do_sync(POST_SYNC, static_cast<unsigned>(inst_id));
@@ -3173,6 +3474,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             } else {
                 icount++;
                 instret++;
+                // a short backward jump may close an idle loop
+                if(*NEXT_PC < pc.val && pc.val - *NEXT_PC <= idle_loop_max_span && idle_if && idle_if->idle_loop_detection())
+                    idle_if->idle_loop_head(*NEXT_PC);
+                if(hpm && hpm->instr_active)
+                    hpm->count_instr<traits::XLEN>(instr, this->core.reg.last_branch != 0);
             }
             *PC = *NEXT_PC;
             this->core.reg.trap_state =  this->core.reg.pending_trap;
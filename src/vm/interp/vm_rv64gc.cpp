@@ -33,6 +33,7 @@
 // clang-format off
 #include <cstdint>
 #include <iss/arch/rv64gc.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/iss.h>
@@ -47,6 +48,7 @@
 #include <exception>
 #include <vector>
 #include <iss/instruction_decoder.h>
+#include <vm/disass_cache.h>
 
 
 #ifndef FMT_HEADER_ONLY
@@ -65,10 +67,6 @@ using namespace iss::arch;
 using namespace iss::debugger;
 using namespace std::placeholders;
 
-struct memory_access_exception : public std::exception{
-    memory_access_exception(){}
-};
-
 template <typename ARCH> class vm_impl : public iss::interp::vm_base<ARCH> {
 public:
     using traits = arch::traits<ARCH>;
@@ -127,6 +125,8 @@ protected:
     }
     uint64_t fetch_count{0};
     uint64_t tval{0};
+    arch::riscv_hart_if* const idle_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
+    arch::hpm_counters* const hpm{idle_if ? &idle_if->get_hpm() : nullptr};
 
     using yield_t = boost::coroutines2::coroutine<void>::push_type;
     using coro_t = boost::coroutines2::coroutine<void>::pull_type;
@@ -397,6 +397,9 @@ private:
     //needs to be declared after instr_descr
     decoder instr_decoder;
 
+    //! formatted disassembly of the instructions seen so far
+    disass_cache disass_texts;
+
     iss::status fetch_ins(virt_addr_t pc, uint8_t * data){
         if (this->core.read({iss::address_type::LOGICAL, pc.access, arch::traits<ARCH>::IMEM, pc.val}, 4, data) != iss::Ok)
                     return iss::Err;
@@ -433,7 +436,11 @@ vm_impl<ARCH>::vm_impl(ARCH &core, unsigned core_id, unsigned cluster_id)
             g_instr_descr.push_back(new_instr_descr);
     }
         return std::move(g_instr_descr);
-    }()) {}
+    }()) {
+    // the instruction class events are counted by this VM
+    if(hpm)
+        hpm->support_instr_events();
+}
 
 inline bool is_icount_limit_enabled(finish_cond_e cond){
     return (cond & finish_cond_e::ICOUNT_LIMIT) == finish_cond_e::ICOUNT_LIMIT;
@@ -482,17 +489,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             // pre execution stuff
              this->core.reg.last_branch = 0;
             if(this->sync_exec && PRE_SYNC) this->do_sync(PRE_SYNC, static_cast<unsigned>(inst_id));
-            try{
                 switch(inst_id){
                 case arch::traits<ARCH>::opcode_e::LUI: {
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "lui"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -515,11 +524,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,20>(instr) << 12));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#08x}", fmt::arg("mnemonic", "auipc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -542,11 +554,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint32_t imm = ((bit_sub<12,8>(instr) << 12) | (bit_sub<20,1>(instr) << 11) | (bit_sub<21,10>(instr) << 1) | (bit_sub<31,1>(instr) << 20));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#0x}", fmt::arg("mnemonic", "jal"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -579,11 +594,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm:#0x}", fmt::arg("mnemonic", "jalr"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -617,11 +635,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "beq"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -653,11 +674,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bne"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -689,11 +713,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "blt"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -725,11 +752,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bge"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -761,11 +791,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bltu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -797,11 +830,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rs2}, {imm:#0x}", fmt::arg("mnemonic", "bgeu"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -833,11 +869,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lb"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -851,7 +890,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t load_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         int8_t res_1 = super::template read_mem<int8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int8_t res = (int8_t)res_1;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res;
@@ -865,11 +904,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lh"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -883,7 +925,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t load_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         int16_t res_2 = super::template read_mem<int16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int16_t res = (int16_t)res_2;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res;
@@ -897,11 +939,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -915,7 +960,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t load_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         int32_t res_3 = super::template read_mem<int32_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res = (int32_t)res_3;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res;
@@ -929,11 +974,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lbu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -947,7 +995,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t load_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         uint8_t res_4 = super::template read_mem<uint8_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint8_t res = res_4;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res;
@@ -961,11 +1009,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lhu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -979,7 +1030,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t load_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         uint16_t res_5 = super::template read_mem<uint16_t>(traits::MEM, load_address);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint16_t res = res_5;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res;
@@ -993,11 +1044,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sb"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1011,7 +1065,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t store_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint8_t>(traits::MEM, store_address, (uint8_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -1021,11 +1075,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sh"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1039,7 +1096,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t store_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint16_t>(traits::MEM, store_address, (uint16_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -1049,11 +1106,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sw"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1067,7 +1127,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t store_address = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint32_t>(traits::MEM, store_address, (uint32_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -1077,11 +1137,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1105,11 +1168,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "slti"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1133,11 +1199,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "sltiu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1161,11 +1230,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "xori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1189,11 +1261,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "ori"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1217,11 +1292,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "andi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1245,11 +1323,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,6>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1273,11 +1354,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,6>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srli"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1301,11 +1385,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,6>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srai"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1329,11 +1416,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "add"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1357,11 +1447,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sub"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1385,11 +1478,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sll"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1413,11 +1509,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "slt"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1441,11 +1540,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sltu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1469,11 +1571,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "xor"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1497,11 +1602,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srl"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1525,11 +1633,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sra"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1553,11 +1664,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "or"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1581,11 +1695,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "and"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1611,11 +1728,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t pred = ((bit_sub<24,4>(instr)));
                     uint8_t fm = ((bit_sub<28,4>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
-                            fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {pred}, {succ} ({fm} , {rs1}, {rd})", fmt::arg("mnemonic", "fence"),
+                                fmt::arg("pred", pred), fmt::arg("succ", succ), fmt::arg("fm", fm), fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1623,16 +1743,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint64_t>(traits::FENCE, traits::fence, (uint8_t)pred << 4 | succ);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::ECALL: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ecall";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ecall";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1645,10 +1768,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::EBREAK: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "ebreak";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "ebreak";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1661,10 +1787,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::MRET: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "mret";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "mret";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1677,10 +1806,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::WFI: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "wfi";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "wfi";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -1696,11 +1828,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lwu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "lwu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1714,7 +1849,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         uint32_t res_6 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res = (uint32_t)res_6;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res;
@@ -1728,11 +1863,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "ld"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "ld"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1746,7 +1884,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         int64_t res_7 = super::template read_mem<int64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int64_t res = (int64_t)res_7;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res;
@@ -1760,11 +1898,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sd"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "sd"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1778,7 +1919,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -1788,11 +1929,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addiw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {imm}", fmt::arg("mnemonic", "addiw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1817,11 +1961,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slliw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "slliw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1846,11 +1993,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srliw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "srliw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1875,11 +2025,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t shamt = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "sraiw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {shamt}", fmt::arg("mnemonic", "sraiw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1904,10 +2057,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "addw";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "addw";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1932,10 +2088,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "subw";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "subw";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1960,11 +2119,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sllw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sllw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -1990,11 +2152,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srlw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "srlw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2020,11 +2185,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sraw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "sraw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2050,11 +2218,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2069,15 +2240,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint64_t xrs1 = *(X+rs1);
                                         if(rd != 0) {
                                             uint64_t res_8 = super::template read_mem<uint64_t>(traits::CSR, csr);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             uint64_t xrd = res_8;
                                             super::template write_mem<uint64_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = xrd;
                                         }
                                         else {
                                             super::template write_mem<uint64_t>(traits::CSR, csr, xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -2088,11 +2259,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrs"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2105,12 +2279,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint64_t res_9 = super::template read_mem<uint64_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t xrd = res_9;
                                         uint64_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint64_t>(traits::CSR, csr, xrd | xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -2124,11 +2298,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {rs1}", fmt::arg("mnemonic", "csrrc"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2141,12 +2318,12 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint64_t res_10 = super::template read_mem<uint64_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t xrd = res_10;
                                         uint64_t xrs1 = *(X+rs1);
                                         if(rs1 != 0) {
                                             super::template write_mem<uint64_t>(traits::CSR, csr, xrd & ~xrs1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -2160,11 +2337,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrwi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2177,10 +2357,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint64_t res_11 = super::template read_mem<uint64_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t xrd = res_11;
                                         super::template write_mem<uint64_t>(traits::CSR, csr, (uint64_t)zimm);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
                                         }
@@ -2193,11 +2373,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrsi"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2210,11 +2393,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint64_t res_12 = super::template read_mem<uint64_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t xrd = res_12;
                                         if(zimm != 0) {
                                             super::template write_mem<uint64_t>(traits::CSR, csr, xrd | (uint64_t)zimm);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -2228,11 +2411,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t zimm = ((bit_sub<15,5>(instr)));
                     uint16_t csr = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
-                            fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {csr}, {zimm:#0x}", fmt::arg("mnemonic", "csrrci"),
+                                fmt::arg("rd", name(rd)), fmt::arg("csr", csr), fmt::arg("zimm", zimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2245,11 +2431,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     }
                                     else {
                                         uint64_t res_13 = super::template read_mem<uint64_t>(traits::CSR, csr);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t xrd = res_13;
                                         if(zimm != 0) {
                                             super::template write_mem<uint64_t>(traits::CSR, csr, xrd & ~((uint64_t)zimm));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = xrd;
@@ -2263,11 +2449,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {rd}, {imm}", fmt::arg("mnemonic", "fence_i"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -2275,7 +2464,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint64_t>(traits::FENCE, traits::fencei, imm);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
@@ -2284,11 +2473,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mul"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2313,11 +2505,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulh"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2342,11 +2537,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhsu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2371,11 +2569,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulhu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2400,11 +2601,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "div"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2441,11 +2645,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2476,11 +2683,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "rem"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2519,11 +2729,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remu"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2554,11 +2767,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "mulw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2583,11 +2799,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2628,11 +2847,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "divuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2665,11 +2887,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2708,11 +2933,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "remuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2747,11 +2975,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {aq}, {rl}", fmt::arg("mnemonic", "lrw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2766,10 +2997,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         if(rd != 0) {
                                             uint64_t offs = *(X+rs1);
                                             int32_t res_14 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint64_t)((int32_t)res_14);
                                             super::template write_mem<uint8_t>(traits::RES, offs, (uint8_t)- 1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -2782,11 +3013,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {aq}, {rl}", fmt::arg("mnemonic", "scw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", name(aq)), fmt::arg("rl", name(rl)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2800,11 +3034,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint8_t res_15 = super::template read_mem<uint8_t>(traits::RES, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_15;
                                         if(res1 != 0) {
                                             super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = res1? 0 : 1;
@@ -2820,11 +3054,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2840,11 +3077,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint64_t res = *(X+rs2);
                                         if(rd != 0) {
                                             int32_t res_16 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint64_t)((int32_t)res_16);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)res);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2856,11 +3093,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2874,14 +3114,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         int32_t res_17 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_17;
                                         int64_t res2 = (int64_t)(res1) + (int64_t)((int32_t)*(X+rs2));
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2893,11 +3133,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxorw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2911,14 +3154,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint32_t res_18 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_18;
                                         uint32_t res2 = res1 ^ (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint64_t)(int64_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2930,11 +3173,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2948,14 +3194,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint32_t res_19 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_19;
                                         uint32_t res2 = res1 & (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint64_t)(int64_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -2967,11 +3213,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoorw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -2985,14 +3234,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint32_t res_20 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_20;
                                         uint32_t res2 = res1 | (uint32_t)*(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint64_t)(int64_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3004,11 +3253,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3022,14 +3274,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         int32_t res_21 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_21;
                                         uint32_t res2 = res1 > (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : ((uint32_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3041,11 +3293,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3059,14 +3314,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         int32_t res_22 = super::template read_mem<int32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int32_t res1 = (int32_t)res_22;
                                         uint32_t res2 = res1 < (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : ((uint32_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3078,11 +3333,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3096,14 +3354,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint32_t res_23 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_23;
                                         uint32_t res2 = res1 > (uint32_t)*(X+rs2)? (uint32_t)*(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = ((uint64_t)(int64_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3115,11 +3373,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxuw"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3133,14 +3394,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint32_t res_24 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint32_t res1 = res_24;
                                         uint32_t res2 = res1 < (int32_t)*(X+rs2)? (uint32_t)*(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = ((uint64_t)(int64_t)(int32_t)res1);
                                         }
                                         super::template write_mem<uint32_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3151,11 +3412,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "lrd"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "lrd"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3170,10 +3434,10 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         if(rd != 0) {
                                             uint64_t offs = *(X+rs1);
                                             int64_t res_25 = super::template read_mem<int64_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint64_t)((int64_t)res_25);
                                             super::template write_mem<uint8_t>(traits::RES, offs, (uint8_t)- 1);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                     }
                                 }
@@ -3186,11 +3450,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "scd"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "scd"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3204,11 +3471,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint8_t res_26 = super::template read_mem<uint8_t>(traits::RES, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res = res_26;
                                         if(res != 0) {
                                             super::template write_mem<uint64_t>(traits::MEM, offs, *(X+rs2));
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         }
                                         if(rd != 0) {
                                             *(X+rd) = res? 0 : 1;
@@ -3224,11 +3491,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapd"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoswapd"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3244,11 +3514,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                         uint64_t res = *(X+rs2);
                                         if(rd != 0) {
                                             int64_t res_27 = super::template read_mem<int64_t>(traits::MEM, offs);
-                                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                             *(X+rd) = (uint64_t)((int64_t)res_27);
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)res);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3260,11 +3530,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddd"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoaddd"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3278,14 +3551,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint64_t res_28 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res1 = res_28;
                                         uint64_t res2 = (uint64_t)((uint128_t)(res1) + (uint128_t)(*(X+rs2)));
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3297,11 +3570,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxord"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoxord"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3315,14 +3591,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint64_t res_29 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res1 = res_29;
                                         uint64_t res2 = res1 ^ *(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = ((uint64_t)(int64_t)res1);
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3334,11 +3610,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandd"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoandd"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3352,14 +3631,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint64_t res_30 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res1 = res_30;
                                         uint64_t res2 = res1 & *(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3371,11 +3650,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoord"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amoord"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3389,14 +3671,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint64_t res_31 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res1 = res_31;
                                         uint64_t res2 = res1 | *(X+rs2);
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3408,11 +3690,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomind"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomind"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3426,14 +3711,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         int64_t res_32 = super::template read_mem<int64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int64_t res1 = (int64_t)res_32;
                                         uint64_t res2 = res1 > (int64_t)*(X+rs2)? (uint64_t)*(X+rs2) : ((uint64_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3445,11 +3730,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxd"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxd"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3463,14 +3751,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         int64_t res_33 = super::template read_mem<int64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         int64_t res1 = (int64_t)res_33;
                                         uint64_t res2 = res1 < (int64_t)*(X+rs2)? (uint64_t)*(X+rs2) : ((uint64_t)res1);
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3482,11 +3770,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominud"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amominud"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3500,14 +3791,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint64_t res_34 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res1 = res_34;
                                         uint64_t res2 = res1 > *(X+rs2)? *(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3519,11 +3810,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rl = ((bit_sub<25,1>(instr)));
                     uint8_t aq = ((bit_sub<26,1>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxud"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2} (aqu = {aq},rel = {rl})", fmt::arg("mnemonic", "amomaxud"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rs2", name(rs2)), fmt::arg("aq", aq), fmt::arg("rl", rl));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3537,14 +3831,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = *(X+rs1);
                                         uint64_t res_35 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res1 = res_35;
                                         uint64_t res2 = res1 < *(X+rs2)? (uint64_t)*(X+rs2) : res1;
                                         if(rd != 0) {
                                             *(X+rd) = (uint64_t)res1;
                                         }
                                         super::template write_mem<uint64_t>(traits::MEM, offs, res2);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -3553,11 +3847,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<2,3>(instr)));
                     uint16_t imm = ((bit_sub<5,1>(instr) << 3) | (bit_sub<6,1>(instr) << 2) | (bit_sub<7,4>(instr) << 6) | (bit_sub<11,2>(instr) << 4));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.addi4spn"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3579,11 +3876,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.lw"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3593,7 +3893,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1 + 8)) + (uint128_t)(uimm));
                         int32_t res_36 = super::template read_mem<int32_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         *(X+rd + 8) = (uint64_t)(int32_t)res_36;
                     }
                     break;
@@ -3603,11 +3903,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm},({rs1})", fmt::arg("mnemonic", "c.ld"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm},({rs1})", fmt::arg("mnemonic", "c.ld"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3617,7 +3920,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1 + 8)) + (uint128_t)(uimm));
                         uint64_t res_37 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         *(X+rd + 8) = (uint64_t)res_37;
                     }
                     break;
@@ -3627,11 +3930,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 2) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
-                            fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm:#05x}({rs1})", fmt::arg("mnemonic", "c.sw"),
+                                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3641,7 +3947,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1 + 8)) + (uint128_t)(uimm));
                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2 + 8));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -3650,11 +3956,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm},({rs1})", fmt::arg("mnemonic", "c.sd"),
-                            fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm},({rs1})", fmt::arg("mnemonic", "c.sd"),
+                                fmt::arg("rs2", name(8+rs2)), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3664,7 +3973,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1 + 8)) + (uint128_t)(uimm));
                         super::template write_mem<uint64_t>(traits::MEM, offs, *(X+rs2 + 8));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -3672,11 +3981,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addi"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3698,10 +4010,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__NOP: {
                     uint8_t nzimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "c.nop";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "c.nop";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3715,11 +4030,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addiw"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.addiw"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3743,11 +4061,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.li"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3770,11 +4091,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint32_t imm = ((bit_sub<2,5>(instr) << 12) | (bit_sub<12,1>(instr) << 17));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
-                            fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm:#05x}", fmt::arg("mnemonic", "c.lui"),
+                                fmt::arg("rd", name(rd)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3794,11 +4118,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__ADDI16SP: {
                     uint16_t nzimm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 7) | (bit_sub<5,1>(instr) << 6) | (bit_sub<6,1>(instr) << 4) | (bit_sub<12,1>(instr) << 9));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
-                            fmt::arg("nzimm", nzimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {nzimm:#05x}", fmt::arg("mnemonic", "c.addi16sp"),
+                                fmt::arg("nzimm", nzimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3818,10 +4145,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::__reserved_clui: {
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = ".reserved_clui";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = ".reserved_clui";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -3836,11 +4166,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t nzuimm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.srli"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("nzuimm", nzuimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {nzuimm}", fmt::arg("mnemonic", "c.srli"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("nzuimm", nzuimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3856,11 +4189,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t shamt = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.srai"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3876,11 +4212,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t imm = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.andi"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3896,11 +4235,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.sub"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3916,11 +4258,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.xor"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3936,11 +4281,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.or"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3956,11 +4304,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.and"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3976,11 +4327,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.subw"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.subw"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -3997,11 +4351,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,3>(instr)));
                     uint8_t rd = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.addw"),
-                            fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rd}, {rs2}", fmt::arg("mnemonic", "c.addw"),
+                                fmt::arg("rd", name(8+rd)), fmt::arg("rd", name(8+rd)), fmt::arg("rs2", name(8+rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4017,11 +4374,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__J: {
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,3>(instr) << 1) | (bit_sub<6,1>(instr) << 7) | (bit_sub<7,1>(instr) << 6) | (bit_sub<8,1>(instr) << 10) | (bit_sub<9,2>(instr) << 8) | (bit_sub<11,1>(instr) << 4) | (bit_sub<12,1>(instr) << 11));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
-                            fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {imm:#05x}", fmt::arg("mnemonic", "c.j"),
+                                fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -4037,11 +4397,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.beqz"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4060,11 +4423,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t imm = ((bit_sub<2,1>(instr) << 5) | (bit_sub<3,2>(instr) << 1) | (bit_sub<5,2>(instr) << 6) | (bit_sub<10,2>(instr) << 3) | (bit_sub<12,1>(instr) << 8));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
-                            fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {imm:#05x}", fmt::arg("mnemonic", "c.bnez"),
+                                fmt::arg("rs1", name(8+rs1)), fmt::arg("imm", imm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4083,11 +4449,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t shamt = ((bit_sub<2,5>(instr)) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.slli"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {shamt}", fmt::arg("mnemonic", "c.slli"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("shamt", shamt));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4110,11 +4479,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<2,2>(instr) << 6) | (bit_sub<4,3>(instr) << 2) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.lwsp"),
-                            fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.lwsp"),
+                                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4128,7 +4500,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                         else {
                             uint64_t offs = (uint64_t)((uint128_t)(*(X+2)) + (uint128_t)(uimm));
                             int32_t res_38 = super::template read_mem<int32_t>(traits::MEM, offs);
-                            if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                            if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                             *(X+rd) = (uint64_t)(int32_t)res_38;
                         }
                     }
@@ -4138,11 +4510,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t uimm = ((bit_sub<2,3>(instr) << 6) | (bit_sub<5,2>(instr) << 3) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {uimm}(sp)", fmt::arg("mnemonic", "c.ldsp"),
-                            fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {uimm}(sp)", fmt::arg("mnemonic", "c.ldsp"),
+                                fmt::arg("rd", name(rd)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4156,7 +4531,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+2)) + (uint128_t)(uimm));
                                         uint64_t res_39 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         uint64_t res = (uint64_t)res_39;
                                         *(X+rd) = res;
                                     }
@@ -4167,11 +4542,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.mv"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4193,11 +4571,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JR: {
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
-                            fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jr"),
+                                fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4218,10 +4599,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::__reserved_cmv: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = ".reserved_cmv";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = ".reserved_cmv";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -4236,11 +4620,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs2}", fmt::arg("mnemonic", "c.add"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs2", name(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4262,11 +4649,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 case arch::traits<ARCH>::opcode_e::C__JALR: {
                     uint8_t rs1 = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
-                            fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}", fmt::arg("mnemonic", "c.jalr"),
+                                fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4289,10 +4679,13 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::C__EBREAK: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "c.ebreak";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "c.ebreak";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -4307,11 +4700,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint8_t uimm = ((bit_sub<7,2>(instr) << 6) | (bit_sub<9,4>(instr) << 2));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm:#05x}(sp)", fmt::arg("mnemonic", "c.swsp"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4325,7 +4721,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+2)) + (uint128_t)(uimm));
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -4334,11 +4730,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint16_t uimm = ((bit_sub<7,3>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {uimm}(sp)", fmt::arg("mnemonic", "c.sdsp"),
-                            fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {uimm}(sp)", fmt::arg("mnemonic", "c.sdsp"),
+                                fmt::arg("rs2", name(rs2)), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4352,17 +4751,20 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+2)) + (uint128_t)(uimm));
                                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(X+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::DII: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "dii";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "dii";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -4378,11 +4780,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "flw"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4397,7 +4802,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint32_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         uint32_t res_40 = super::template read_mem<uint32_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         *(F+rd) = NaNBox32(res_40);
                                     }
                                 }
@@ -4408,11 +4813,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
-                            fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsw"),
+                                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -4427,7 +4835,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint32_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint32_t>(traits::MEM, offs, (uint32_t)*(F+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -4438,11 +4846,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4463,11 +4874,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4488,11 +4902,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4513,11 +4930,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4537,11 +4957,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4561,11 +4984,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4585,11 +5011,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4611,11 +5040,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4637,11 +5069,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4663,11 +5098,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4689,11 +5127,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -4713,11 +5154,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4746,11 +5190,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4779,11 +5226,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4812,11 +5262,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4845,11 +5298,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.w"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4875,11 +5331,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.wu"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4905,11 +5364,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.l"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.l"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4935,11 +5397,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.lu"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.lu"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4965,11 +5430,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -4986,11 +5454,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5007,11 +5478,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5027,11 +5501,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.w"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -5055,11 +5532,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.w.x"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5082,11 +5562,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5115,11 +5598,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5148,11 +5634,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5180,11 +5669,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.s"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5210,11 +5702,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint16_t imm = ((bit_sub<20,12>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {imm}({rs1})", fmt::arg("mnemonic", "fld"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -5229,7 +5724,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         uint64_t res_41 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                         *(F+rd) = NaNBox64(res_41);
                                     }
                                 }
@@ -5240,11 +5735,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
-                            fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs2}, {imm}({rs1})", fmt::arg("mnemonic", "fsd"),
+                                fmt::arg("rs2", fname(rs2)), fmt::arg("imm", imm), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -5259,7 +5757,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                                     else {
                                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1)) + (int128_t)((int16_t)sext<12>(imm)));
                                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(F+rs2));
-                                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                     }
                                 }
                     break;
@@ -5270,11 +5768,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fadd.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5295,11 +5796,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fsub.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5320,11 +5824,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fmul.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5345,11 +5852,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rm}", fmt::arg("mnemonic", "fdiv.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5369,11 +5879,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmin.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5393,11 +5906,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fmax.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5417,11 +5933,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fsqrt.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5443,11 +5962,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmadd.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5469,11 +5991,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fmsub.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5496,11 +6021,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmadd.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5522,11 +6050,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     uint8_t rs3 = ((bit_sub<27,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}, {rs3}, {rm}", fmt::arg("mnemonic", "fnmsub.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)), fmt::arg("rs3", fname(rs3)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5546,11 +6077,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.w.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5579,11 +6113,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.wu.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5612,11 +6149,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.l.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5645,11 +6185,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.lu.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5678,11 +6221,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.w"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5708,11 +6254,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.wu"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5738,11 +6287,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.l"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.l"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5768,11 +6320,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.lu"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.lu"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5798,11 +6353,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.s.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]); 
@@ -5822,11 +6380,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rm = ((bit_sub<12,3>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rm}", fmt::arg("mnemonic", "fcvt.d.s"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rm", rm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5843,11 +6404,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnj.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5864,11 +6428,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjn.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5885,11 +6452,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fsgnjx.d"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5905,11 +6475,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.x.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -5933,11 +6506,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.d.x"),
-                            fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fmv.d.x"),
+                                fmt::arg("rd", fname(rd)), fmt::arg("rs1", name(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5960,11 +6536,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "feq.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -5993,11 +6572,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "flt.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -6026,11 +6608,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t rs2 = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}, {rs2}", fmt::arg("mnemonic", "fle.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)), fmt::arg("rs2", fname(rs2)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -6058,11 +6643,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
-                            fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rd}, {rs1}", fmt::arg("mnemonic", "fclass.d"),
+                                fmt::arg("rd", name(rd)), fmt::arg("rs1", fname(rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* F = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::F0]);
@@ -6088,11 +6676,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
-                            fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f(8+{rd}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fld"),
+                                fmt::arg("rd", rd), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -6103,7 +6694,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1 + 8)) + (uint128_t)(uimm));
                         uint64_t res_42 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         uint64_t res = (uint64_t)res_42;
                         *(F+rd + 8) = NaNBox64(res);
                     }
@@ -6114,11 +6705,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t uimm = ((bit_sub<5,2>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     uint8_t rs1 = ((bit_sub<7,3>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
-                            fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f(8+{rs2}), {uimm}({rs1})", fmt::arg("mnemonic", "c.fsd"),
+                                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm), fmt::arg("rs1", name(8+rs1)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -6129,7 +6723,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+rs1 + 8)) + (uint128_t)(uimm));
                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(F+rs2 + 8));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -6137,11 +6731,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint16_t uimm = ((bit_sub<2,3>(instr) << 6) | (bit_sub<5,2>(instr) << 3) | (bit_sub<12,1>(instr) << 5));
                     uint8_t rd = ((bit_sub<7,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
-                            fmt::arg("rd", rd), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f {rd}, {uimm}(x2)", fmt::arg("mnemonic", "c.fldsp"),
+                                fmt::arg("rd", rd), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -6152,7 +6749,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+2)) + (uint128_t)(uimm));
                         uint64_t res_43 = super::template read_mem<uint64_t>(traits::MEM, offs);
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                         uint64_t res = (uint64_t)res_43;
                         *(F+rd) = NaNBox64(res);
                     }
@@ -6162,11 +6759,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs2 = ((bit_sub<2,5>(instr)));
                     uint16_t uimm = ((bit_sub<7,3>(instr) << 6) | (bit_sub<10,3>(instr) << 3));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
-                            fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} f {rs2}, {uimm}(x2), ", fmt::arg("mnemonic", "c.fsdsp"),
+                                fmt::arg("rs2", rs2), fmt::arg("uimm", uimm));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     auto* X = reinterpret_cast<uint64_t*>(this->regs_base_ptr+arch::traits<ARCH>::reg_byte_offsets[arch::traits<ARCH>::X0]);
@@ -6177,7 +6777,7 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     {
                         uint64_t offs = (uint64_t)((uint128_t)(*(X+2)) + (uint128_t)(uimm));
                         super::template write_mem<uint64_t>(traits::MEM, offs, (uint64_t)*(F+rs2));
-                        if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                        if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                     }
                     break;
                 }// @suppress("No break at end of case")
@@ -6185,11 +6785,14 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     uint8_t rs1 = ((bit_sub<15,5>(instr)));
                     uint8_t asid = ((bit_sub<20,5>(instr)));
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        auto mnemonic = fmt::format(
-                            "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
-                            fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            auto mnemonic = fmt::format(
+                                "{mnemonic:10} {rs1}, {asid}", fmt::arg("mnemonic", "sfence.vma"),
+                                fmt::arg("rs1", name(rs1)), fmt::arg("asid", name(asid)));
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -6197,16 +6800,19 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                     // execute instruction
                     {
                                     super::template write_mem<uint64_t>(traits::FENCE, traits::fencevma, ((uint16_t)(uint8_t)rs1<<8)|(uint8_t)asid);
-                                    if(this->core.reg.trap_state>=0x80000000UL) throw memory_access_exception();
+                                    if(this->core.reg.trap_state>=0x80000000UL) goto trap_exit;
                                 }
                     break;
                 }// @suppress("No break at end of case")
                 case arch::traits<ARCH>::opcode_e::SRET: {
                     if(this->disass_enabled){
-                        /* generate console output when executing the command */
-                        //No disass specified, using instruction name
-                        std::string mnemonic = "sret";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, [&]() {
+                            /* generate console output when executing the command */
+                            //No disass specified, using instruction name
+                            std::string mnemonic = "sret";
+                            return mnemonic;
+                        });
+                        this->core.disass_output(pc.val, text);
                     }
                     // used registers
                     // calculate next pc value
@@ -6226,14 +6832,15 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
                         }
                     }
                     if(this->disass_enabled){
-                        std::string mnemonic = "Illegal Instruction";
-                        this->core.disass_output(pc.val, mnemonic);
+                        auto const& text = disass_texts.get(pc.val, instr, []() { return std::string("Illegal Instruction"); });
+                        this->core.disass_output(pc.val, text);
                     }
                     *NEXT_PC = *PC + ((instr & 3) == 3 ? 4 : 2);
                     raise(0, traits::RV_CAUSE_ILLEGAL_INSTRUCTION);
                 }
                 }
-            }catch(memory_access_exception& e){}
+            // memory access faults skip the remainder of the instruction behavior
+            trap_exit:
             // post execution stuff
             process_spawn_blocks();
             if(this->sync_exec && POST_SYNC) this->do_sync(POST_SYNC, static_cast<unsigned>(inst_id));
@@ -6247,6 +6854,11 @@ typename vm_base<ARCH>::virt_addr_t vm_impl<ARCH>::execute_inst(finish_cond_e co
             } else {
                 icount++;
                 instret++;
+                // a short backward jump may close an idle loop
+                if(*NEXT_PC < pc.val && pc.val - *NEXT_PC <= idle_loop_max_span && idle_if && idle_if->idle_loop_detection())
+                    idle_if->idle_loop_head(*NEXT_PC);
+                if(hpm && hpm->instr_active)
+                    hpm->count_instr<traits::XLEN>(instr, this->core.reg.last_branch != 0);
             }
             *PC = *NEXT_PC;
             this->core.reg.trap_state =  this->core.reg.pending_trap;
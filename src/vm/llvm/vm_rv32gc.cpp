@@ -38,6 +38,7 @@
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/instruction_decoder.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <util/logging.h>
 
 #include <fp_functions.h>
@@ -124,12 +125,20 @@ protected:
         this->builder.CreateStore(next_pc_v, get_reg_ptr(reg_num), true);
     }
 
+    //! the hart recognizes the memory accesses of LR, SC and AMOs by the instruction word, so it is set for every instruction
+    inline void gen_set_instr(code_word_t instr) {
+        this->builder.CreateStore(this->gen_const(32, instr), get_reg_ptr(traits::INSTRUCTION), false);
+    }
+
     // some compile time constants
 
     using this_class = vm_impl<ARCH>;
     using compile_func = std::tuple<continuation_e, BasicBlock *> (this_class::*)(virt_addr_t &pc,
                                                                                   code_word_t instr,
                                                                                   BasicBlock *bb);
+    std::tuple<continuation_e, BasicBlock *> gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index,
+                                                                 compile_func f, BasicBlock *bb);
+    arch::riscv_hart_if* const hart_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
     template<unsigned W, typename U, typename S = typename std::make_signed<U>::type>
     inline S sext(U from) {
         auto mask = (1ULL<<W) - 1;
@@ -543,6 +552,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -589,6 +599,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -635,6 +646,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -692,6 +704,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -773,6 +786,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -838,6 +852,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -903,6 +918,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -972,6 +988,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1041,6 +1058,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1106,6 +1124,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1171,6 +1190,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1229,6 +1249,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1287,6 +1308,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1345,6 +1367,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1401,6 +1424,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1457,6 +1481,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1510,6 +1535,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1563,6 +1589,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1616,6 +1643,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1668,6 +1696,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1722,6 +1751,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1775,6 +1805,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1825,6 +1856,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1875,6 +1907,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1925,6 +1958,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1975,6 +2009,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2025,6 +2060,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2077,6 +2113,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2129,6 +2166,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2181,6 +2219,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2234,6 +2273,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2289,6 +2329,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2342,6 +2383,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2392,6 +2434,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2445,6 +2488,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2501,6 +2545,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2551,6 +2596,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2603,6 +2649,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2639,6 +2686,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2674,6 +2722,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2709,6 +2758,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2744,6 +2794,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2785,6 +2836,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2841,6 +2893,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2898,6 +2951,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2955,6 +3009,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3006,6 +3061,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3062,6 +3118,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3118,6 +3175,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3158,6 +3216,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3213,6 +3272,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3271,6 +3331,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3328,6 +3389,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3384,6 +3446,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3488,6 +3551,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3561,6 +3625,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3669,6 +3734,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3743,6 +3809,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3799,6 +3866,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3871,6 +3939,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3931,6 +4000,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3997,6 +4067,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4061,6 +4132,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4125,6 +4197,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4189,6 +4262,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4259,6 +4333,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4329,6 +4404,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4398,6 +4474,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4464,6 +4541,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4514,6 +4592,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4564,6 +4643,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4611,6 +4691,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4660,6 +4741,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4695,6 +4777,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4738,6 +4821,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4784,6 +4868,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4827,6 +4912,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4874,6 +4960,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4911,6 +4998,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4953,6 +5041,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5013,6 +5102,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5057,6 +5147,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5101,6 +5192,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5143,6 +5235,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5185,6 +5278,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5226,6 +5320,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5266,6 +5361,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5319,6 +5415,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5372,6 +5469,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5421,6 +5519,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5475,6 +5574,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5520,6 +5620,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5565,6 +5666,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5602,6 +5704,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5652,6 +5755,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5702,6 +5806,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5739,6 +5844,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5788,6 +5894,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5826,6 +5933,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5877,6 +5985,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5931,6 +6040,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5998,6 +6108,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6065,6 +6176,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6132,6 +6244,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6198,6 +6311,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6264,6 +6378,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6330,6 +6445,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6394,6 +6510,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6467,6 +6584,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6540,6 +6658,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6613,6 +6732,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6684,6 +6804,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6760,6 +6881,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6836,6 +6958,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6902,6 +7025,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6968,6 +7092,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7015,6 +7140,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7062,6 +7188,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7114,6 +7241,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7166,6 +7294,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7213,6 +7342,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7287,6 +7417,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7361,6 +7492,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7434,6 +7566,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7488,6 +7621,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7537,6 +7671,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7584,6 +7719,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7632,6 +7768,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7680,6 +7817,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7731,6 +7869,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7785,6 +7924,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7852,6 +7992,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7919,6 +8060,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7986,6 +8128,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8052,6 +8195,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8118,6 +8262,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8184,6 +8329,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8248,6 +8394,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8321,6 +8468,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8395,6 +8543,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8468,6 +8617,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8539,6 +8689,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8615,6 +8766,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8691,6 +8843,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8757,6 +8910,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8823,6 +8977,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8885,6 +9040,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8932,6 +9088,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8979,6 +9136,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9026,6 +9184,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9079,6 +9238,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9155,6 +9315,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9231,6 +9392,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9306,6 +9468,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9362,6 +9525,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9411,6 +9575,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9458,6 +9623,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9506,6 +9672,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9553,6 +9720,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9589,6 +9757,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9679,9 +9848,74 @@ vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, BasicBlock *this_block)
     if (f == nullptr) {
         f = &this_class::illegal_instruction;
     }
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    if(is_csr_read && f != &this_class::illegal_instruction)
+        return gen_inline_csr_read(pc, instr, inst_index, f, this_block);
     return (this->*f)(pc, instr, this_block);
 }
 
+template <typename ARCH>
+std::tuple<continuation_e, BasicBlock *>
+vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index, compile_func f, BasicBlock *this_block) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = hart_if ? hart_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, this_block);
+    auto const start_pc = pc;
+    auto cont = CONT;
+    BasicBlock *bb = nullptr;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    if(auto const req_priv = (csr >> 8) & 0x3) {
+        auto *fast_bb = BasicBlock::Create(this->mod->getContext(), "csr_read", this->func, this->leave_blk);
+        auto *slow_bb = BasicBlock::Create(this->mod->getContext(), "csr_read_slow", this->func, this->leave_blk);
+        auto *priv = gen_reg_load(traits::PRIV);
+        this->gen_cond_branch(this->builder.CreateICmp(ICmpInst::ICMP_UGE, priv,
+                                                       ConstantInt::get(getContext(), APInt(priv->getType()->getIntegerBitWidth(), req_priv))),
+                              fast_bb, slow_bb, 1);
+        this->builder.SetInsertPoint(slow_bb);
+        std::tie(cont, bb) = (this->*f)(pc, instr, slow_bb);
+        this->builder.SetInsertPoint(fast_bb);
+    } else {
+        pc = pc + 4;
+        bb = BasicBlock::Create(this->mod->getContext(), "entry", this->func, this->leave_blk);
+    }
+    this->gen_sync(PRE_SYNC, inst_index);
+    this->gen_set_pc(start_pc, traits::PC);
+    this->set_tval(instr);
+    this->gen_set_pc(start_pc + 4, traits::NEXT_PC);
+    this->gen_instr_prologue();
+    auto *i64_type = this->builder.getInt64Ty();
+    Value *value = nullptr;
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN: {
+        auto *type = this->get_type(traits::XLEN);
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.ptr)), PointerType::getUnqual(type));
+        value = this->builder.CreateZExt(this->builder.CreateLoad(type, ptr, true), i64_type);
+        break;
+    }
+    case arch::csr_inline_read::CYCLE: {
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.offset)), PointerType::getUnqual(i64_type));
+        value = this->builder.CreateAdd(gen_reg_load(traits::CYCLE), this->builder.CreateLoad(i64_type, ptr, true));
+        if(descr.divider > 1)
+            value = this->builder.CreateUDiv(value, this->gen_const(64, descr.divider));
+        break;
+    }
+    default:
+        value = gen_reg_load(traits::INSTRET);
+        break;
+    }
+    if(descr.shift)
+        value = this->builder.CreateLShr(value, this->gen_const(64, descr.shift));
+    if(rd != 0)
+        this->builder.CreateStore(this->builder.CreateTrunc(value, this->get_type(traits::XLEN)), get_reg_ptr(traits::X0 + rd), false);
+    this->gen_sync(POST_SYNC, inst_index);
+    this->gen_instr_epilogue(bb);
+    this->builder.CreateBr(bb);
+    return std::make_tuple(cont, bb);
+}
+
 template <typename ARCH>
 void vm_impl<ARCH>::gen_leave_behavior(BasicBlock *leave_blk) {
     this->builder.SetInsertPoint(leave_blk);
@@ -38,6 +38,7 @@
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/instruction_decoder.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <util/logging.h>
 
 #ifndef FMT_HEADER_ONLY
@@ -121,12 +122,20 @@ protected:
         this->builder.CreateStore(next_pc_v, get_reg_ptr(reg_num), true);
     }
 
+    //! the hart recognizes the memory accesses of LR, SC and AMOs by the instruction word, so it is set for every instruction
+    inline void gen_set_instr(code_word_t instr) {
+        this->builder.CreateStore(this->gen_const(32, instr), get_reg_ptr(traits::INSTRUCTION), false);
+    }
+
     // some compile time constants
 
     using this_class = vm_impl<ARCH>;
     using compile_func = std::tuple<continuation_e, BasicBlock *> (this_class::*)(virt_addr_t &pc,
                                                                                   code_word_t instr,
                                                                                   BasicBlock *bb);
+    std::tuple<continuation_e, BasicBlock *> gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index,
+                                                                 compile_func f, BasicBlock *bb);
+    arch::riscv_hart_if* const hart_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
     template<unsigned W, typename U, typename S = typename std::make_signed<U>::type>
     inline S sext(U from) {
         auto mask = (1ULL<<W) - 1;
@@ -273,6 +282,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -319,6 +329,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -365,6 +376,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -422,6 +434,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -503,6 +516,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -568,6 +582,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -633,6 +648,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -702,6 +718,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -771,6 +788,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -836,6 +854,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -901,6 +920,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -959,6 +979,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1017,6 +1038,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1075,6 +1097,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1131,6 +1154,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1187,6 +1211,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1240,6 +1265,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1293,6 +1319,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1346,6 +1373,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1398,6 +1426,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1452,6 +1481,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1505,6 +1535,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1555,6 +1586,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1605,6 +1637,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1655,6 +1688,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1705,6 +1739,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1755,6 +1790,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1807,6 +1843,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1859,6 +1896,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1911,6 +1949,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1964,6 +2003,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2019,6 +2059,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2072,6 +2113,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2122,6 +2164,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2175,6 +2218,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2231,6 +2275,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2281,6 +2326,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2333,6 +2379,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2369,6 +2416,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2404,6 +2452,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2439,6 +2488,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2474,6 +2524,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2515,6 +2566,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2571,6 +2623,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2628,6 +2681,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2685,6 +2739,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2736,6 +2791,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2792,6 +2848,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2848,6 +2905,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2939,9 +2997,74 @@ vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, BasicBlock *this_block)
     if (f == nullptr) {
         f = &this_class::illegal_instruction;
     }
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    if(is_csr_read && f != &this_class::illegal_instruction)
+        return gen_inline_csr_read(pc, instr, inst_index, f, this_block);
     return (this->*f)(pc, instr, this_block);
 }
 
+template <typename ARCH>
+std::tuple<continuation_e, BasicBlock *>
+vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index, compile_func f, BasicBlock *this_block) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = hart_if ? hart_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, this_block);
+    auto const start_pc = pc;
+    auto cont = CONT;
+    BasicBlock *bb = nullptr;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    if(auto const req_priv = (csr >> 8) & 0x3) {
+        auto *fast_bb = BasicBlock::Create(this->mod->getContext(), "csr_read", this->func, this->leave_blk);
+        auto *slow_bb = BasicBlock::Create(this->mod->getContext(), "csr_read_slow", this->func, this->leave_blk);
+        auto *priv = gen_reg_load(traits::PRIV);
+        this->gen_cond_branch(this->builder.CreateICmp(ICmpInst::ICMP_UGE, priv,
+                                                       ConstantInt::get(getContext(), APInt(priv->getType()->getIntegerBitWidth(), req_priv))),
+                              fast_bb, slow_bb, 1);
+        this->builder.SetInsertPoint(slow_bb);
+        std::tie(cont, bb) = (this->*f)(pc, instr, slow_bb);
+        this->builder.SetInsertPoint(fast_bb);
+    } else {
+        pc = pc + 4;
+        bb = BasicBlock::Create(this->mod->getContext(), "entry", this->func, this->leave_blk);
+    }
+    this->gen_sync(PRE_SYNC, inst_index);
+    this->gen_set_pc(start_pc, traits::PC);
+    this->set_tval(instr);
+    this->gen_set_pc(start_pc + 4, traits::NEXT_PC);
+    this->gen_instr_prologue();
+    auto *i64_type = this->builder.getInt64Ty();
+    Value *value = nullptr;
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN: {
+        auto *type = this->get_type(traits::XLEN);
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.ptr)), PointerType::getUnqual(type));
+        value = this->builder.CreateZExt(this->builder.CreateLoad(type, ptr, true), i64_type);
+        break;
+    }
+    case arch::csr_inline_read::CYCLE: {
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.offset)), PointerType::getUnqual(i64_type));
+        value = this->builder.CreateAdd(gen_reg_load(traits::CYCLE), this->builder.CreateLoad(i64_type, ptr, true));
+        if(descr.divider > 1)
+            value = this->builder.CreateUDiv(value, this->gen_const(64, descr.divider));
+        break;
+    }
+    default:
+        value = gen_reg_load(traits::INSTRET);
+        break;
+    }
+    if(descr.shift)
+        value = this->builder.CreateLShr(value, this->gen_const(64, descr.shift));
+    if(rd != 0)
+        this->builder.CreateStore(this->builder.CreateTrunc(value, this->get_type(traits::XLEN)), get_reg_ptr(traits::X0 + rd), false);
+    this->gen_sync(POST_SYNC, inst_index);
+    this->gen_instr_epilogue(bb);
+    this->builder.CreateBr(bb);
+    return std::make_tuple(cont, bb);
+}
+
 template <typename ARCH>
 void vm_impl<ARCH>::gen_leave_behavior(BasicBlock *leave_blk) {
     this->builder.SetInsertPoint(leave_blk);
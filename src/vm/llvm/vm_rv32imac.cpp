@@ -38,6 +38,7 @@
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/instruction_decoder.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <util/logging.h>
 
 #ifndef FMT_HEADER_ONLY
@@ -121,12 +122,20 @@ protected:
         this->builder.CreateStore(next_pc_v, get_reg_ptr(reg_num), true);
     }
 
+    //! the hart recognizes the memory accesses of LR, SC and AMOs by the instruction word, so it is set for every instruction
+    inline void gen_set_instr(code_word_t instr) {
+        this->builder.CreateStore(this->gen_const(32, instr), get_reg_ptr(traits::INSTRUCTION), false);
+    }
+
     // some compile time constants
 
     using this_class = vm_impl<ARCH>;
     using compile_func = std::tuple<continuation_e, BasicBlock *> (this_class::*)(virt_addr_t &pc,
                                                                                   code_word_t instr,
                                                                                   BasicBlock *bb);
+    std::tuple<continuation_e, BasicBlock *> gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index,
+                                                                 compile_func f, BasicBlock *bb);
+    arch::riscv_hart_if* const hart_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
     template<unsigned W, typename U, typename S = typename std::make_signed<U>::type>
     inline S sext(U from) {
         auto mask = (1ULL<<W) - 1;
@@ -371,6 +380,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -417,6 +427,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -463,6 +474,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -520,6 +532,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -601,6 +614,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -666,6 +680,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -731,6 +746,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -800,6 +816,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -869,6 +886,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -934,6 +952,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -999,6 +1018,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1057,6 +1077,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1115,6 +1136,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1173,6 +1195,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1229,6 +1252,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1285,6 +1309,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1338,6 +1363,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1391,6 +1417,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1444,6 +1471,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1496,6 +1524,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1550,6 +1579,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1603,6 +1633,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1653,6 +1684,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1703,6 +1735,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1753,6 +1786,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1803,6 +1837,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1853,6 +1888,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1905,6 +1941,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1957,6 +1994,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2009,6 +2047,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2062,6 +2101,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2117,6 +2157,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2170,6 +2211,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2220,6 +2262,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2273,6 +2316,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2329,6 +2373,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2379,6 +2424,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2431,6 +2477,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2467,6 +2514,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2502,6 +2550,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2537,6 +2586,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2572,6 +2622,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2613,6 +2664,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2669,6 +2721,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2726,6 +2779,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2783,6 +2837,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2834,6 +2889,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2890,6 +2946,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2946,6 +3003,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2986,6 +3044,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3041,6 +3100,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3099,6 +3159,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3156,6 +3217,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3212,6 +3274,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3316,6 +3379,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3389,6 +3453,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3497,6 +3562,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3571,6 +3637,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3627,6 +3694,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3699,6 +3767,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3759,6 +3828,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3825,6 +3895,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3889,6 +3960,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3953,6 +4025,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4017,6 +4090,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4087,6 +4161,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4157,6 +4232,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4226,6 +4302,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4292,6 +4369,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4342,6 +4420,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4392,6 +4471,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4439,6 +4519,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4488,6 +4569,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4523,6 +4605,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4566,6 +4649,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4612,6 +4696,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4655,6 +4740,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4702,6 +4788,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4739,6 +4826,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4781,6 +4869,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4841,6 +4930,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4885,6 +4975,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4929,6 +5020,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4971,6 +5063,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5013,6 +5106,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5054,6 +5148,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5094,6 +5189,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5147,6 +5243,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5200,6 +5297,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5249,6 +5347,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5303,6 +5402,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5348,6 +5448,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5393,6 +5494,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5430,6 +5532,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5480,6 +5583,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5530,6 +5634,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5567,6 +5672,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5616,6 +5722,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5705,9 +5812,74 @@ vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, BasicBlock *this_block)
     if (f == nullptr) {
         f = &this_class::illegal_instruction;
     }
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    if(is_csr_read && f != &this_class::illegal_instruction)
+        return gen_inline_csr_read(pc, instr, inst_index, f, this_block);
     return (this->*f)(pc, instr, this_block);
 }
 
+template <typename ARCH>
+std::tuple<continuation_e, BasicBlock *>
+vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index, compile_func f, BasicBlock *this_block) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = hart_if ? hart_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, this_block);
+    auto const start_pc = pc;
+    auto cont = CONT;
+    BasicBlock *bb = nullptr;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    if(auto const req_priv = (csr >> 8) & 0x3) {
+        auto *fast_bb = BasicBlock::Create(this->mod->getContext(), "csr_read", this->func, this->leave_blk);
+        auto *slow_bb = BasicBlock::Create(this->mod->getContext(), "csr_read_slow", this->func, this->leave_blk);
+        auto *priv = gen_reg_load(traits::PRIV);
+        this->gen_cond_branch(this->builder.CreateICmp(ICmpInst::ICMP_UGE, priv,
+                                                       ConstantInt::get(getContext(), APInt(priv->getType()->getIntegerBitWidth(), req_priv))),
+                              fast_bb, slow_bb, 1);
+        this->builder.SetInsertPoint(slow_bb);
+        std::tie(cont, bb) = (this->*f)(pc, instr, slow_bb);
+        this->builder.SetInsertPoint(fast_bb);
+    } else {
+        pc = pc + 4;
+        bb = BasicBlock::Create(this->mod->getContext(), "entry", this->func, this->leave_blk);
+    }
+    this->gen_sync(PRE_SYNC, inst_index);
+    this->gen_set_pc(start_pc, traits::PC);
+    this->set_tval(instr);
+    this->gen_set_pc(start_pc + 4, traits::NEXT_PC);
+    this->gen_instr_prologue();
+    auto *i64_type = this->builder.getInt64Ty();
+    Value *value = nullptr;
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN: {
+        auto *type = this->get_type(traits::XLEN);
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.ptr)), PointerType::getUnqual(type));
+        value = this->builder.CreateZExt(this->builder.CreateLoad(type, ptr, true), i64_type);
+        break;
+    }
+    case arch::csr_inline_read::CYCLE: {
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.offset)), PointerType::getUnqual(i64_type));
+        value = this->builder.CreateAdd(gen_reg_load(traits::CYCLE), this->builder.CreateLoad(i64_type, ptr, true));
+        if(descr.divider > 1)
+            value = this->builder.CreateUDiv(value, this->gen_const(64, descr.divider));
+        break;
+    }
+    default:
+        value = gen_reg_load(traits::INSTRET);
+        break;
+    }
+    if(descr.shift)
+        value = this->builder.CreateLShr(value, this->gen_const(64, descr.shift));
+    if(rd != 0)
+        this->builder.CreateStore(this->builder.CreateTrunc(value, this->get_type(traits::XLEN)), get_reg_ptr(traits::X0 + rd), false);
+    this->gen_sync(POST_SYNC, inst_index);
+    this->gen_instr_epilogue(bb);
+    this->builder.CreateBr(bb);
+    return std::make_tuple(cont, bb);
+}
+
 template <typename ARCH>
 void vm_impl<ARCH>::gen_leave_behavior(BasicBlock *leave_blk) {
     this->builder.SetInsertPoint(leave_blk);
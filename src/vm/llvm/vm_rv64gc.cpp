@@ -38,6 +38,7 @@
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/instruction_decoder.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <util/logging.h>
 
 #include <fp_functions.h>
@@ -124,12 +125,20 @@ protected:
         this->builder.CreateStore(next_pc_v, get_reg_ptr(reg_num), true);
     }
 
+    //! the hart recognizes the memory accesses of LR, SC and AMOs by the instruction word, so it is set for every instruction
+    inline void gen_set_instr(code_word_t instr) {
+        this->builder.CreateStore(this->gen_const(32, instr), get_reg_ptr(traits::INSTRUCTION), false);
+    }
+
     // some compile time constants
 
     using this_class = vm_impl<ARCH>;
     using compile_func = std::tuple<continuation_e, BasicBlock *> (this_class::*)(virt_addr_t &pc,
                                                                                   code_word_t instr,
                                                                                   BasicBlock *bb);
+    std::tuple<continuation_e, BasicBlock *> gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index,
+                                                                 compile_func f, BasicBlock *bb);
+    arch::riscv_hart_if* const hart_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
     template<unsigned W, typename U, typename S = typename std::make_signed<U>::type>
     inline S sext(U from) {
         auto mask = (1ULL<<W) - 1;
@@ -623,6 +632,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -669,6 +679,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -715,6 +726,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -772,6 +784,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -853,6 +866,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -918,6 +932,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -983,6 +998,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1052,6 +1068,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1121,6 +1138,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1186,6 +1204,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1251,6 +1270,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1309,6 +1329,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1367,6 +1388,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1425,6 +1447,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1481,6 +1504,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1537,6 +1561,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1590,6 +1615,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1643,6 +1669,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1696,6 +1723,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1748,6 +1776,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1802,6 +1831,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1855,6 +1885,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1905,6 +1936,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1955,6 +1987,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2005,6 +2038,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2055,6 +2089,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2105,6 +2140,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2159,6 +2195,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2211,6 +2248,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2263,6 +2301,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2316,6 +2355,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2371,6 +2411,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2424,6 +2465,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2474,6 +2516,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2527,6 +2570,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2583,6 +2627,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2633,6 +2678,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2685,6 +2731,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2721,6 +2768,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2756,6 +2804,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2791,6 +2840,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2826,6 +2876,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2867,6 +2918,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2925,6 +2977,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2983,6 +3036,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3036,6 +3090,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3090,6 +3145,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3145,6 +3201,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3200,6 +3257,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3253,6 +3311,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3310,6 +3369,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3368,6 +3428,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3429,6 +3490,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3490,6 +3552,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3550,6 +3613,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3606,6 +3670,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3663,6 +3728,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3720,6 +3786,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3771,6 +3838,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3827,6 +3895,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3883,6 +3952,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3923,6 +3993,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3978,6 +4049,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4036,6 +4108,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4093,6 +4166,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4149,6 +4223,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4253,6 +4328,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4326,6 +4402,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4434,6 +4511,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4507,6 +4585,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4566,6 +4645,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4677,6 +4757,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4761,6 +4842,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4880,6 +4962,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -4971,6 +5054,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5027,6 +5111,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5099,6 +5184,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5159,6 +5245,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5225,6 +5312,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5289,6 +5377,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5353,6 +5442,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5417,6 +5507,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5487,6 +5578,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5557,6 +5649,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5626,6 +5719,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5694,6 +5788,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5750,6 +5845,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5820,6 +5916,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5880,6 +5977,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -5942,6 +6040,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6003,6 +6102,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6063,6 +6163,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6123,6 +6224,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6193,6 +6295,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6263,6 +6366,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6326,6 +6430,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6388,6 +6493,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6438,6 +6544,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6488,6 +6595,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6536,6 +6644,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6584,6 +6693,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6629,6 +6739,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6678,6 +6789,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6714,6 +6826,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6769,6 +6882,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6815,6 +6929,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6858,6 +6973,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6905,6 +7021,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6942,6 +7059,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -6984,6 +7102,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7030,6 +7149,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7074,6 +7194,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7118,6 +7239,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7160,6 +7282,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7202,6 +7325,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7244,6 +7368,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7295,6 +7420,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7345,6 +7471,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7385,6 +7512,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7438,6 +7566,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7491,6 +7620,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7540,6 +7670,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7594,6 +7725,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7647,6 +7779,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7692,6 +7825,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7737,6 +7871,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7774,6 +7909,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7824,6 +7960,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7874,6 +8011,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7911,6 +8049,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -7963,6 +8102,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8012,6 +8152,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8050,6 +8191,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8101,6 +8243,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8155,6 +8298,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8222,6 +8366,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8289,6 +8434,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8356,6 +8502,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8422,6 +8569,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8488,6 +8636,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8554,6 +8703,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8618,6 +8768,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8691,6 +8842,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8764,6 +8916,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8837,6 +8990,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8908,6 +9062,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -8984,6 +9139,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9060,6 +9216,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9136,6 +9293,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9206,6 +9364,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9272,6 +9431,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9338,6 +9498,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9402,6 +9563,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9466,6 +9628,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9513,6 +9676,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9560,6 +9724,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9612,6 +9777,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9664,6 +9830,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9711,6 +9878,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9785,6 +9953,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9859,6 +10028,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9932,6 +10102,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -9986,6 +10157,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10037,6 +10209,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10091,6 +10264,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10158,6 +10332,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10225,6 +10400,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10292,6 +10468,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10358,6 +10535,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10424,6 +10602,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10490,6 +10669,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10554,6 +10734,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10627,6 +10808,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10701,6 +10883,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10774,6 +10957,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10845,6 +11029,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10921,6 +11106,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -10997,6 +11183,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11073,6 +11260,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11143,6 +11331,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11209,6 +11398,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11275,6 +11465,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11339,6 +11530,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11403,6 +11595,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11465,6 +11658,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11512,6 +11706,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11559,6 +11754,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11606,6 +11802,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11658,6 +11855,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11710,6 +11908,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11757,6 +11956,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11833,6 +12033,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11909,6 +12110,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -11984,6 +12186,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -12040,6 +12243,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -12089,6 +12293,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -12136,6 +12341,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -12184,6 +12390,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 2;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -12231,6 +12438,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -12267,6 +12475,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -12357,9 +12566,74 @@ vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, BasicBlock *this_block)
     if (f == nullptr) {
         f = &this_class::illegal_instruction;
     }
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    if(is_csr_read && f != &this_class::illegal_instruction)
+        return gen_inline_csr_read(pc, instr, inst_index, f, this_block);
     return (this->*f)(pc, instr, this_block);
 }
 
+template <typename ARCH>
+std::tuple<continuation_e, BasicBlock *>
+vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index, compile_func f, BasicBlock *this_block) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = hart_if ? hart_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, this_block);
+    auto const start_pc = pc;
+    auto cont = CONT;
+    BasicBlock *bb = nullptr;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    if(auto const req_priv = (csr >> 8) & 0x3) {
+        auto *fast_bb = BasicBlock::Create(this->mod->getContext(), "csr_read", this->func, this->leave_blk);
+        auto *slow_bb = BasicBlock::Create(this->mod->getContext(), "csr_read_slow", this->func, this->leave_blk);
+        auto *priv = gen_reg_load(traits::PRIV);
+        this->gen_cond_branch(this->builder.CreateICmp(ICmpInst::ICMP_UGE, priv,
+                                                       ConstantInt::get(getContext(), APInt(priv->getType()->getIntegerBitWidth(), req_priv))),
+                              fast_bb, slow_bb, 1);
+        this->builder.SetInsertPoint(slow_bb);
+        std::tie(cont, bb) = (this->*f)(pc, instr, slow_bb);
+        this->builder.SetInsertPoint(fast_bb);
+    } else {
+        pc = pc + 4;
+        bb = BasicBlock::Create(this->mod->getContext(), "entry", this->func, this->leave_blk);
+    }
+    this->gen_sync(PRE_SYNC, inst_index);
+    this->gen_set_pc(start_pc, traits::PC);
+    this->set_tval(instr);
+    this->gen_set_pc(start_pc + 4, traits::NEXT_PC);
+    this->gen_instr_prologue();
+    auto *i64_type = this->builder.getInt64Ty();
+    Value *value = nullptr;
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN: {
+        auto *type = this->get_type(traits::XLEN);
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.ptr)), PointerType::getUnqual(type));
+        value = this->builder.CreateZExt(this->builder.CreateLoad(type, ptr, true), i64_type);
+        break;
+    }
+    case arch::csr_inline_read::CYCLE: {
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.offset)), PointerType::getUnqual(i64_type));
+        value = this->builder.CreateAdd(gen_reg_load(traits::CYCLE), this->builder.CreateLoad(i64_type, ptr, true));
+        if(descr.divider > 1)
+            value = this->builder.CreateUDiv(value, this->gen_const(64, descr.divider));
+        break;
+    }
+    default:
+        value = gen_reg_load(traits::INSTRET);
+        break;
+    }
+    if(descr.shift)
+        value = this->builder.CreateLShr(value, this->gen_const(64, descr.shift));
+    if(rd != 0)
+        this->builder.CreateStore(this->builder.CreateTrunc(value, this->get_type(traits::XLEN)), get_reg_ptr(traits::X0 + rd), false);
+    this->gen_sync(POST_SYNC, inst_index);
+    this->gen_instr_epilogue(bb);
+    this->builder.CreateBr(bb);
+    return std::make_tuple(cont, bb);
+}
+
 template <typename ARCH>
 void vm_impl<ARCH>::gen_leave_behavior(BasicBlock *leave_blk) {
     this->builder.SetInsertPoint(leave_blk);
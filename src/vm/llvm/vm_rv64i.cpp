@@ -38,6 +38,7 @@
 #include <iss/debugger/gdb_session.h>
 #include <iss/debugger/server.h>
 #include <iss/instruction_decoder.h>
+#include <iss/arch/riscv_hart_common.h>
 #include <util/logging.h>
 
 #ifndef FMT_HEADER_ONLY
@@ -121,12 +122,20 @@ protected:
         this->builder.CreateStore(next_pc_v, get_reg_ptr(reg_num), true);
     }
 
+    //! the hart recognizes the memory accesses of LR, SC and AMOs by the instruction word, so it is set for every instruction
+    inline void gen_set_instr(code_word_t instr) {
+        this->builder.CreateStore(this->gen_const(32, instr), get_reg_ptr(traits::INSTRUCTION), false);
+    }
+
     // some compile time constants
 
     using this_class = vm_impl<ARCH>;
     using compile_func = std::tuple<continuation_e, BasicBlock *> (this_class::*)(virt_addr_t &pc,
                                                                                   code_word_t instr,
                                                                                   BasicBlock *bb);
+    std::tuple<continuation_e, BasicBlock *> gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index,
+                                                                 compile_func f, BasicBlock *bb);
+    arch::riscv_hart_if* const hart_if{dynamic_cast<arch::riscv_hart_if*>(&this->core)};
     template<unsigned W, typename U, typename S = typename std::make_signed<U>::type>
     inline S sext(U from) {
         auto mask = (1ULL<<W) - 1;
@@ -297,6 +306,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -343,6 +353,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -389,6 +400,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -446,6 +458,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -527,6 +540,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -592,6 +606,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -657,6 +672,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -726,6 +742,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -795,6 +812,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -860,6 +878,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -925,6 +944,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -983,6 +1003,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1041,6 +1062,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1099,6 +1121,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1155,6 +1178,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1211,6 +1235,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1264,6 +1289,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1317,6 +1343,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1370,6 +1397,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1422,6 +1450,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1476,6 +1505,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1529,6 +1559,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1579,6 +1610,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1629,6 +1661,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1679,6 +1712,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1729,6 +1763,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1779,6 +1814,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1833,6 +1869,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1885,6 +1922,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1937,6 +1975,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -1990,6 +2029,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2045,6 +2085,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2098,6 +2139,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2148,6 +2190,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2201,6 +2244,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2257,6 +2301,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2307,6 +2352,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2359,6 +2405,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2395,6 +2442,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2430,6 +2478,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2465,6 +2514,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2500,6 +2550,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2541,6 +2592,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2599,6 +2651,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2657,6 +2710,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2710,6 +2764,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2764,6 +2819,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2819,6 +2875,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2874,6 +2931,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2927,6 +2985,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -2984,6 +3043,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3042,6 +3102,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3103,6 +3164,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3164,6 +3226,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3224,6 +3287,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3280,6 +3344,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3337,6 +3402,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3394,6 +3460,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3445,6 +3512,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3501,6 +3569,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3557,6 +3626,7 @@ private:
         
         this->gen_set_pc(pc, traits::PC);
         this->set_tval(instr);
+        this->gen_set_instr(instr);
         pc=pc+ 4;
         this->gen_set_pc(pc, traits::NEXT_PC);
         
@@ -3648,9 +3718,74 @@ vm_impl<ARCH>::gen_single_inst_behavior(virt_addr_t &pc, BasicBlock *this_block)
     if (f == nullptr) {
         f = &this_class::illegal_instruction;
     }
+    // side effect free CSR reads (csrrs/csrrc rd, csr, x0 and the immediate variants) may be compiled inline
+    auto const is_csr_read = (instr & 0x7f) == 0x73 && (bit_sub<12, 3>(instr) & 3) >= 2 && bit_sub<15, 5>(instr) == 0;
+    if(is_csr_read && f != &this_class::illegal_instruction)
+        return gen_inline_csr_read(pc, instr, inst_index, f, this_block);
     return (this->*f)(pc, instr, this_block);
 }
 
+template <typename ARCH>
+std::tuple<continuation_e, BasicBlock *>
+vm_impl<ARCH>::gen_inline_csr_read(virt_addr_t &pc, code_word_t instr, uint32_t inst_index, compile_func f, BasicBlock *this_block) {
+    auto const rd = bit_sub<7, 5>(instr);
+    auto const csr = bit_sub<20, 12>(instr);
+    auto const descr = hart_if ? hart_if->get_csr_inline_read(csr) : arch::csr_inline_read{};
+    if(descr.src == arch::csr_inline_read::NONE || rd >= traits::RFS || this->disass_enabled)
+        return (this->*f)(pc, instr, this_block);
+    auto const start_pc = pc;
+    auto cont = CONT;
+    BasicBlock *bb = nullptr;
+    // the block might be executed in a lower privilege mode than it has been translated in, so this needs a check
+    if(auto const req_priv = (csr >> 8) & 0x3) {
+        auto *fast_bb = BasicBlock::Create(this->mod->getContext(), "csr_read", this->func, this->leave_blk);
+        auto *slow_bb = BasicBlock::Create(this->mod->getContext(), "csr_read_slow", this->func, this->leave_blk);
+        auto *priv = gen_reg_load(traits::PRIV);
+        this->gen_cond_branch(this->builder.CreateICmp(ICmpInst::ICMP_UGE, priv,
+                                                       ConstantInt::get(getContext(), APInt(priv->getType()->getIntegerBitWidth(), req_priv))),
+                              fast_bb, slow_bb, 1);
+        this->builder.SetInsertPoint(slow_bb);
+        std::tie(cont, bb) = (this->*f)(pc, instr, slow_bb);
+        this->builder.SetInsertPoint(fast_bb);
+    } else {
+        pc = pc + 4;
+        bb = BasicBlock::Create(this->mod->getContext(), "entry", this->func, this->leave_blk);
+    }
+    this->gen_sync(PRE_SYNC, inst_index);
+    this->gen_set_pc(start_pc, traits::PC);
+    this->set_tval(instr);
+    this->gen_set_pc(start_pc + 4, traits::NEXT_PC);
+    this->gen_instr_prologue();
+    auto *i64_type = this->builder.getInt64Ty();
+    Value *value = nullptr;
+    switch(descr.src) {
+    case arch::csr_inline_read::PLAIN: {
+        auto *type = this->get_type(traits::XLEN);
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.ptr)), PointerType::getUnqual(type));
+        value = this->builder.CreateZExt(this->builder.CreateLoad(type, ptr, true), i64_type);
+        break;
+    }
+    case arch::csr_inline_read::CYCLE: {
+        auto *ptr = this->builder.CreateIntToPtr(this->gen_const(64, reinterpret_cast<uint64_t>(descr.offset)), PointerType::getUnqual(i64_type));
+        value = this->builder.CreateAdd(gen_reg_load(traits::CYCLE), this->builder.CreateLoad(i64_type, ptr, true));
+        if(descr.divider > 1)
+            value = this->builder.CreateUDiv(value, this->gen_const(64, descr.divider));
+        break;
+    }
+    default:
+        value = gen_reg_load(traits::INSTRET);
+        break;
+    }
+    if(descr.shift)
+        value = this->builder.CreateLShr(value, this->gen_const(64, descr.shift));
+    if(rd != 0)
+        this->builder.CreateStore(this->builder.CreateTrunc(value, this->get_type(traits::XLEN)), get_reg_ptr(traits::X0 + rd), false);
+    this->gen_sync(POST_SYNC, inst_index);
+    this->gen_instr_epilogue(bb);
+    this->builder.CreateBr(bb);
+    return std::make_tuple(cont, bb);
+}
+
 template <typename ARCH>
 void vm_impl<ARCH>::gen_leave_behavior(BasicBlock *leave_blk) {
     this->builder.SetInsertPoint(leave_blk);
@@ -38,6 +38,7 @@
 #include <cstdint>
 #include <limits>
 
+#include "iss/arch/riscv_hart_common.h"
 #include "iss/arch_if.h"
 #include "iss/vm_types.h"
 #include <vector_functions.h>
@@ -84,9 +85,27 @@ inline bool softvec_write(void* core, uint64_t addr, uint64_t length, uint8_t* d
         {iss::address_type::LOGICAL, iss::access_type::WRITE, 0 /*traits<ARCH>::MEM*/, addr}, length, data);
     return status == iss::Ok;
 }
+//! announces the data read by an unmasked unit-stride load for the duration of the instruction
+struct read_burst {
+    read_burst(void* core, uint64_t bytes)
+    : hart(bytes ? dynamic_cast<iss::arch::riscv_hart_if*>(static_cast<iss::arch_if*>(core)) : nullptr) {
+        if(hart)
+            hart->announce_read_burst(bytes);
+    }
+
+    ~read_burst() {
+        if(hart)
+            hart->announce_read_burst(0);
+    }
+
+    iss::arch::riscv_hart_if* hart;
+};
 template <size_t VLEN>
 uint64_t vlseg(void* core, uint8_t* V, uint64_t vl, uint64_t vstart, softvector::vtype_t vtype, bool vm, uint8_t vd, uint64_t rs1_val,
                uint8_t width_val, uint8_t segment_size) {
+    // width_val encodes the element size: 0b000 -> 1, 0b101 -> 2, 0b110 -> 4, 0b111 -> 8 bytes
+    auto const elem_size = width_val ? 1U << (width_val & 3) : 1U;
+    read_burst burst(core, vm && vl > vstart ? (vl - vstart) * segment_size * elem_size : 0);
     switch(width_val) {
     case 0b000:
         return softvector::vector_load_store<VLEN, uint8_t>(core, softvec_read, V, vl, vstart, vtype, vm, vd, rs1_val, segment_size);